@@ -24,6 +24,8 @@ namespace rest
 
         Task<Pointer<Reply>> Send(const Request &request) override;
 
+        Task<Pointer<Reply>> Send(const Request &request, const ogm::Projection &projection) override;
+
         /*
         Task<Event>
         Subscribe(const Uri &uri,
@@ -36,7 +38,7 @@ namespace rest
         void ObserveError(const Function<void(std::__1::error_code)> &handler) override;
 
     private:
-        Pointer<Reply> DoSend(const Request &request);
+        Pointer<Reply> DoSend(const Request &request, const ogm::Projection *projection);
 
         bool ConvertRequest(const Request &from, HTTPRequest &to);
 
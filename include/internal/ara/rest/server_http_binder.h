@@ -9,6 +9,7 @@
 #include "Poco/Net/HTTPRequestHandler.h"
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/StreamCopier.h"
 
 using namespace Poco::Net;
 
@@ -73,39 +74,94 @@ namespace rest
     class ServerHttpRequest : public ServerRequest
     {
     public:
-        static ServerHttpRequest &MakeFrom(HTTPServerRequest *request, const Uri &uri)
+        /**
+         * \brief   Wraps a Poco request. A JSON body of at most JsonDocument::kMaxLazySize is kept unparsed until the
+         *          handler navigates it. Other bodies stay in the request stream and are decoded as they are read,
+         *          with the codec their Content-Type selects, when the handler first accesses the payload.
+         */
+        static Pointer<ServerHttpRequest> MakeFrom(HTTPServerRequest *request, const Uri &uri)
         {
-            static ServerHttpRequest serverRequest(RequestMethod::kGet, uri, ogm::Object::Make(), request);
-            return serverRequest;
+            auto method = ConvertMethod(request->getMethod());
+            auto contentType = ogm::SerializerRegistry::GetMediaType(request->getContentType());
+
+            auto length = request->getContentLength();
+            bool lazy = contentType == "application/json" && length != HTTPServerRequest::UNKNOWN_CONTENT_LENGTH
+                        && static_cast<std::size_t>(length) <= ogm::JsonDocument::kMaxLazySize;
+
+            std::istream &stream = request->stream();
+            if (!lazy && ogm::SerializerRegistry::GetInstance().IsSupported(contentType)
+                && stream.peek() != std::char_traits<char>::eof())
+            {
+                return Pointer<ServerHttpRequest>(new ServerHttpRequest(method, uri, stream, contentType, request));
+            }
+
+            String body;
+            if (length > 0) body.reserve(static_cast<std::size_t>(length));
+            Poco::StreamCopier::copyToString(stream, body);
+
+            return Pointer<ServerHttpRequest>(new ServerHttpRequest(method, uri, std::move(body), request));
         }
 
     private:
-        Pointer<HTTPServerRequest> pocoRequest_;
+        HTTPServerRequest *pocoRequest_;
 
-        ServerHttpRequest(RequestMethod method, const Uri &uri, const Pointer<ogm::Object> &payload, HTTPServerRequest *request)
-                : ServerRequest(method, uri, payload), pocoRequest_(request)
+        ServerHttpRequest(RequestMethod method, const Uri &uri, String &&body, HTTPServerRequest *request)
+                : ServerRequest(method, uri, std::move(body)), pocoRequest_(request)
         {};
+
+        ServerHttpRequest(RequestMethod method, const Uri &uri, std::istream &stream, StringView contentType,
+                          HTTPServerRequest *request)
+                : ServerRequest(method, uri, stream, contentType), pocoRequest_(request)
+        {};
+
+        static RequestMethod ConvertMethod(const std::string &method);
     };
 
     class ServerHttpReply : public ServerReply
     {
     public:
-        static ServerHttpReply &MakeFrom(HTTPServerResponse *reply, const Uri &uri)
+        /**
+         * \brief   Wraps a Poco response. Object payloads are encoded in the media type the Accept header prefers.
+         *          A ?fields=a,b.c query parameter restricts them to the listed fields. If cacheable is set, 2xx
+         *          object replies carry an ETag derived from ogm::Hash, and 304 Not Modified is sent without a body
+         *          if it matches ifNoneMatch.
+         */
+        static Pointer<ServerHttpReply> MakeFrom(HTTPServerResponse *reply, const Uri &uri, StringView accept,
+                                                 bool cacheable = false, StringView ifNoneMatch = StringView())
         {
-            static ServerHttpReply serverReply(Uri(), 0, ogm::Object::Make(), reply);
-            return serverReply;
+            return Pointer<ServerHttpReply>(new ServerHttpReply(uri, StatusCode::HTTP_OK, ogm::Object::Make(), reply,
+                                                                ogm::SerializerRegistry::GetInstance().Negotiate(accept),
+                                                                ParseFields(uri), cacheable, ifNoneMatch));
         }
 
         Task<void> Send(const Pointer<ara::rest::ogm::Object> &data) override;
         Task<void> Send(Pointer<ara::rest::ogm::Object> &&data) override;
         Task<void> Send(const StringView &data) override;
+        Task<void> SendStreamed(const Pointer<ara::rest::ogm::Object> &data) override;
+        Task<void> SendStreamed(StringView contentType, const Function<void(ogm::OutputSink&)> &writer) override;
         Task<void> Redirect(const Uri &uri) override;
 
     private:
-        Pointer<HTTPServerResponse> pocoReply_;
-
-        ServerHttpReply(const Uri &uri, int status, const Pointer<ogm::Object> &payload, HTTPServerResponse *reply)
-                : ServerReply(uri, status, payload), pocoReply_(reply)
+        HTTPServerResponse *pocoReply_;
+        String contentType_;
+        Pointer<ogm::Projection> fields_;
+        bool cacheable_;
+        String ifNoneMatch_;
+
+        Task<void> SendBody(String &&body, StringView contentType, StringView etag = StringView());
+        Task<void> SendNotModified(StringView etag);
+
+        bool IsTagged() const;
+        void Serialize(ogm::Object *object, ogm::OutputSink &sink, bool canonical) const;
+        String MakeETag(const ogm::Object &object) const;
+
+        static Pointer<ogm::Projection> ParseFields(const Uri &uri);
+        static bool MatchesETag(StringView ifNoneMatch, StringView etag);
+
+        ServerHttpReply(const Uri &uri, StatusCode status, Pointer<ogm::Object> &&payload, HTTPServerResponse *reply,
+                        StringView contentType, Pointer<ogm::Projection> &&fields, bool cacheable, StringView ifNoneMatch)
+                : ServerReply(uri, status, std::move(payload)), pocoReply_(reply), contentType_(contentType), fields_(std::move(fields)),
+                  cacheable_(cacheable), ifNoneMatch_(ifNoneMatch)
         {};
     };
 
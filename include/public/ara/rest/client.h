@@ -1,11 +1,15 @@
 #ifndef REST_CLIENT_H
 #define REST_CLIENT_H
 
+#include <mutex>
+
 #include <ara/rest/endpoint.h>
 #include <ara/rest/header.h>
 #include <ara/rest/uri.h>
 #include <ara/rest/support_type.h>
+#include <ara/rest/ogm/arena.h>
 #include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/serializer/json_document.h>
 
 namespace ara
 {
@@ -79,6 +83,12 @@ namespace rest
          */
         Task<Pointer<Reply>> Send(const Request &request);
 
+        /**
+         * \brief   Issues a request to a peer and keeps only the members of the reply payload selected by projection.
+         *          The projection must outlive the returned task.
+         */
+        Task<Pointer<Reply>> Send(const Request &request, const ogm::Projection &projection);
+
         /**
          * \brief   Performs an event subscription.
          *
@@ -133,6 +143,11 @@ namespace rest
          */
         virtual Task<Pointer<Reply>> Send(const Request &request) = 0;
 
+        /**
+         * \brief   Issues a request to a peer and deserializes only the selected part of the reply payload.
+         */
+        virtual Task<Pointer<Reply>> Send(const Request &request, const ogm::Projection &projection) = 0;
+
         /**
          * \brief   Performs an event subscription.
          */
@@ -256,6 +271,16 @@ namespace rest
         Reply(const Uri &uri, StatusCode status, const Pointer<ogm::Object> &payload);
         Reply(const Uri &uri, StatusCode status, Pointer<ogm::Object> &&payload);
 
+        /**
+         * \brief   Constructs a Reply that keeps the raw payload and parses it on demand.
+         */
+        Reply(const Uri &uri, StatusCode status, String &&binary);
+
+        /**
+         * \brief   Constructs a Reply whose payload was built inside arena. The reply owns the arena.
+         */
+        Reply(const Uri &uri, StatusCode status, Pointer<ogm::Arena> &&arena, Pointer<ogm::Object> &&payload);
+
     public:
         /**
          * \brief   Obtains the message header.
@@ -265,14 +290,20 @@ namespace rest
         ReplyHeader const & GetHeader() const;
 
         /**
-         * \brief   Obtains the reply message payload.
+         * \brief   Obtains the reply message payload. A reply without a body has an empty object.
          *
          * \satisfy [SWS_REST_02171] Syntax Requirement for ara::rest::Reply::GetObject.
          */
         ogm::Object const& GetObject() const;
 
         /**
-         * \brief   Obtains the reply message payload.
+         * \brief   Obtains a lazy view of the reply payload. Only the navigated subtrees are parsed. A payload whose
+         *          structure is broken gives an invalid view.
+         */
+        ogm::JsonView GetView() const;
+
+        /**
+         * \brief   Obtains the reply message payload. A reply without a body has an empty object.
          *
          * \satisfy [SWS_REST_02172] Syntax Requirement for ara::rest::Reply::ReleaseObject.
          */
@@ -287,7 +318,16 @@ namespace rest
 
     private:
         ReplyHeader header_;
-        // Pointer<ogm::Object> payload_;
+        Pointer<ogm::Arena> arena_;
+        mutable Pointer<ogm::Object> payload_;
+        mutable Pointer<ogm::JsonDocument> document_;
+
+        /**
+         * Guards the lazily parsed members above, so that the const accessors may be called from several threads.
+         */
+        mutable std::mutex mutex_;
+
+        const ogm::Object &GetPayload() const;
     };
 
     class Event
@@ -101,6 +101,14 @@ namespace rest
             return std::to_string(static_cast<uint16_t>(code.code_));
         }
 
+        /**
+         * \brief   Returns true for the 2xx status codes.
+         */
+        constexpr bool IsSuccess() const noexcept
+        {
+            return code_ >= HTTP_OK && code_ < HTTP_MULTIPLE_CHOICES;
+        }
+
     private:
         Code code_;
     };
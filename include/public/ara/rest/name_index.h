@@ -0,0 +1,144 @@
+#ifndef REST_NAME_INDEX_H
+#define REST_NAME_INDEX_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+
+    /**
+     * \brief   Open-addressing hash table from names to positions in a sequence that its owner keeps in insertion
+     *          order, such as the fields of an object.
+     *
+     * Only hashes and positions are stored; the owner resolves a position to its name through the nameOf function
+     * passed to each call, so names are compared only when their hashes match. Of several equal names the first
+     * position is indexed, which is the one a linear search would find. An index that has not been built is
+     * inactive, and owners fall back to a linear search.
+     */
+    class NameIndex
+    {
+    public:
+        /**
+         * \brief   Owners build an index once they hold this many names. Below it a linear search is faster.
+         */
+        static constexpr std::size_t kThreshold = 32;
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    public:
+        bool IsActive() const noexcept
+        {
+            return !slots_.empty();
+        }
+
+        /**
+         * \brief   Returns the first position of name, or npos if it is not indexed.
+         */
+        template <typename NameOf>
+        std::size_t Find(StringView name, NameOf &&nameOf) const noexcept
+        {
+            std::uint32_t hash = HashOf(name);
+            std::size_t mask = slots_.size() - 1;
+
+            for (std::size_t slot = hash & mask; slots_[slot].position != kEmpty; slot = (slot + 1) & mask)
+            {
+                if (slots_[slot].hash == hash && nameOf(slots_[slot].position) == name) return slots_[slot].position;
+            }
+
+            return npos;
+        }
+
+        /**
+         * \brief   Indexes name at position, unless it is already indexed at an earlier one. Positions must be added
+         *          in increasing order.
+         */
+        template <typename NameOf>
+        void Insert(StringView name, std::size_t position, NameOf &&nameOf)
+        {
+            if ((size_ + 1) * 2 > slots_.size()) Grow();
+
+            std::uint32_t hash = HashOf(name);
+            std::size_t mask = slots_.size() - 1;
+
+            std::size_t slot = hash & mask;
+            for (; slots_[slot].position != kEmpty; slot = (slot + 1) & mask)
+            {
+                if (slots_[slot].hash == hash && nameOf(slots_[slot].position) == name) return;
+            }
+
+            slots_[slot] = Slot{ hash, static_cast<std::uint32_t>(position) };
+            size_++;
+        }
+
+        /**
+         * \brief   Indexes the first size positions from scratch, or deactivates the index if size is below
+         *          kThreshold. Owners call it after any change other than an append, which shifts positions.
+         */
+        template <typename NameOf>
+        void Rebuild(std::size_t size, NameOf &&nameOf)
+        {
+            Clear();
+            if (size < kThreshold) return;
+
+            std::size_t capacity = kThreshold * 2;
+            while (capacity < size * 2) capacity *= 2;
+            slots_.assign(capacity, Slot{ 0, kEmpty });
+
+            for (std::size_t position = 0; position < size; position++) Insert(nameOf(position), position, nameOf);
+        }
+
+        void Clear() noexcept
+        {
+            slots_.clear();
+            size_ = 0;
+        }
+
+    private:
+        static constexpr std::uint32_t kEmpty = UINT32_MAX;
+
+        struct Slot
+        {
+            std::uint32_t hash;
+            std::uint32_t position;
+        };
+
+        static std::uint32_t HashOf(StringView name) noexcept
+        {
+            auto hash = static_cast<std::uint64_t>(std::hash<StringView>()(name));
+            return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+        }
+
+        /**
+         * Doubles the table. The stored hashes are enough to place the entries again.
+         */
+        void Grow()
+        {
+            std::vector<Slot> slots(slots_.empty() ? kThreshold * 2 : slots_.size() * 2, Slot{ 0, kEmpty });
+            std::size_t mask = slots.size() - 1;
+
+            for (const Slot &entry : slots_)
+            {
+                if (entry.position == kEmpty) continue;
+
+                std::size_t slot = entry.hash & mask;
+                while (slots[slot].position != kEmpty) slot = (slot + 1) & mask;
+                slots[slot] = entry;
+            }
+
+            slots_ = std::move(slots);
+        }
+
+        std::vector<Slot> slots_;
+        std::size_t size_ = 0;
+    };
+
+}
+}
+
+#endif //REST_NAME_INDEX_H
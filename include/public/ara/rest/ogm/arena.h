@@ -0,0 +1,82 @@
+#ifndef REST_ARENA_H
+#define REST_ARENA_H
+
+#include <cstddef>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+    class Node;
+
+    /**
+     * \brief   Monotonic region that OGM nodes are allocated from while an Arena::Scope is active on their thread.
+     *
+     * Deleting an arena node runs its destructor but returns no memory. Each block of the region is freed once
+     * the Arena and every node in that block are gone, so nodes may safely outlive the Arena (e.g. after
+     * ReleaseObject()) while keeping only their own blocks alive. Only the nodes themselves live in the region;
+     * the buffers they own, such as string contents and member vectors, still come from the heap. Nodes carry
+     * no header: the block a node belongs to is looked up from its address. An Arena must be used by one thread
+     * at a time.
+     */
+    class Arena
+    {
+    public:
+        /**
+         * \brief   Size of the blocks the region grows by. Block sizes are rounded up to a multiple of 4 KiB.
+         */
+        static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+        explicit Arena(std::size_t blockSize = kDefaultBlockSize);
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * \brief   Makes the nodes created on this thread come from an arena until the scope ends. Scopes nest.
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(Arena &arena) noexcept;
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            void *previous_;
+        };
+
+        /**
+         * \brief   Returns the number of bytes the region has reserved from the heap.
+         */
+        std::size_t GetCapacity() const noexcept;
+
+    private:
+        friend Node;
+
+        class Region;
+
+        /**
+         * \brief   Allocates node memory from the active arena of this thread, or from the heap if there is none.
+         */
+        static void *Allocate(std::size_t size);
+
+        static void Deallocate(void *memory) noexcept;
+
+        static thread_local Region *active_;
+
+        Region *region_;
+    };
+
+}
+}
+}
+
+#endif //REST_ARENA_H
@@ -1,10 +1,14 @@
 #ifndef REST_ARRAY_H
 #define REST_ARRAY_H
 
+#include <mutex>
 #include <vector>
 
 #include <ara/rest/iterator.h>
+#include <ara/rest/ogm/copy_on_write.h>
 #include <ara/rest/ogm/value.h>
+#include <ara/rest/ogm/int.h>
+#include <ara/rest/ogm/real.h>
 #include <ara/rest/support_type.h>
 
 namespace ara
@@ -13,6 +17,7 @@ namespace rest
 {
 namespace ogm
 {
+    class JsonSerializer;
 
     class Array : public Value, public Constructible<Array>
     {
@@ -61,7 +66,18 @@ namespace ogm
          */
         using ConstValueRange = IteratorRange<ConstIterator>;
 
+        /**
+         * \brief   Int or Real held inline by an array whose elements are all numbers. Whether a cell is an Int or a
+         *          Real is recorded by the array (IsRealCell()), so a cell is only as large as a long double.
+         */
+        union Cell
+        {
+            Int::ValueType integer;
+            Real::ValueType real;
+        };
+
         friend Constructible<Array>;
+        friend JsonSerializer;
 
     public:
         /**
@@ -113,6 +129,33 @@ namespace ogm
          */
         void Append(std::unique_ptr<Value> &&value);
 
+        /**
+         * \brief   Appends a number. While an array holds nothing but numbers appended this way, they are packed
+         *          into cells; a node is only created for each of them once a caller asks for a reference to an
+         *          element or an iterator, or inserts a Value.
+         */
+        void AppendInt(Int::ValueType value);
+        void AppendReal(Real::ValueType value);
+
+        /**
+         * \brief   Returns true while the elements are packed cells. Readers that only need the numbers use
+         *          GetCell() and IsRealCell() then, which leaves the array packed.
+         */
+        bool IsPacked() const noexcept
+        {
+            return !storage_.Read().cells.empty();
+        }
+
+        const Cell &GetCell(std::size_t index) const noexcept
+        {
+            return storage_.Read().cells[index];
+        }
+
+        bool IsRealCell(std::size_t index) const noexcept
+        {
+            return storage_.Read().reals[index];
+        }
+
         /**
          * \brief   Inserts a Value at a specific position into the Array.
          *
@@ -128,14 +171,16 @@ namespace ogm
         Iterator Remove(Iterator iterator);
 
         /**
-         * \brief   Similar to Remove but does not destroy the removed element.
+         * \brief   Similar to Remove but does not destroy the removed element. Ownership of the element is
+         *          transferred to the caller; nothing is copied.
          *
          * \satisfy [SWS_REST_02055] Syntax Requirement for ara::rest::ogm::Array::Release.
          */
         std::pair<Iterator, std::unique_ptr<Value>> Release(Iterator iterator);
 
         /**
-         * \brief   Replaces an element by a new one without the destroying the old one.
+         * \brief   Replaces an element by a new one without the destroying the old one, which is moved out
+         *          and returned.
          *
          * \satisfy [SWS_REST_02056] Syntax Requirement for ara::rest::ogm::Array::Replace.
          */
@@ -149,18 +194,62 @@ namespace ogm
         void Clear();
 
     protected:
+        /**
+         * The copy shares the elements with this array, as Object::Copy() does with fields.
+         */
         Array *Copy() const override
         {
             auto copyed = new Array();
-            std::for_each(value_.begin(), value_.end(), [this, &copyed](const Pointer<Value> &value){
-                copyed->Append(std::move(ogm::Copy(value)));
-            });
+            copyed->storage_ = storage_;
 
             return copyed;
         }
 
     private:
-        ValueType value_;
+        /**
+         * The array is packed while cells is non-empty; reals tags each cell. values then is either empty or
+         * holds a node for each cell, built once by Unpack() and not copied with the cells.
+         */
+        struct Storage
+        {
+            Storage() = default;
+
+            Storage(const Storage &other) : cells(other.cells), reals(other.reals)
+            {
+                if (!cells.empty()) return;
+
+                values.reserve(other.values.size());
+                for (const Pointer<Value> &value : other.values) values.push_back(ogm::Copy(value));
+            }
+
+            mutable ValueType values;
+            std::vector<Cell> cells;
+            std::vector<bool> reals;
+            mutable std::once_flag unpacked;
+        };
+
+        /**
+         * Creates the nodes of a packed array for the const accessors that return references. The cells are kept,
+         * so readers of a packed array, including those of its copies on other threads, may call it concurrently.
+         */
+        void Unpack() const;
+
+        /**
+         * Returns the nodes of an array that is no longer shared and no longer packed, for the non-const members.
+         */
+        ValueType &WriteValues();
+
+        /**
+         * WriteValues() for the members that hand out mutable references to elements (see CopyOnWrite::Expose()).
+         */
+        ValueType &ExposeValues();
+
+        /**
+         * Appends the elements of tail, keeping the result packed if both are.
+         */
+        void Splice(Array &&tail);
+
+        CopyOnWrite<Storage> storage_;
 
         /**
          * \brief   Connstructs an Array.
@@ -170,7 +259,7 @@ namespace ogm
         template <typename... Ts>
         Array(Pointer<Ts>&&... values) : Value(NodeType::Array)
         {
-            int a[] = {0, (value_.push_back(std::move(values)), 0)...};
+            int a[] = {0, (storage_.Write().values.push_back(std::move(values)), 0)...};
             static_cast<void>(a);
         };
     };
@@ -0,0 +1,60 @@
+#ifndef REST_ATOM_H
+#define REST_ATOM_H
+
+#include <cstdint>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   Interned field name. Equal names share one Atom, so fields compare names by address.
+     *
+     * Atoms live in a global table for the rest of the process. Lookups take no lock; creating an atom does.
+     * The table is bounded: names longer than kMaxLength, and new names once kCapacity atoms exist, are not
+     * interned. Only names the application passes to Field::Make are interned; names read from payloads only
+     * reuse existing atoms, so the same name may be held both with and without one.
+     */
+    class Atom
+    {
+    public:
+        static constexpr std::size_t kMaxLength = 64;
+        static constexpr std::size_t kCapacity = 4096;
+
+        Atom(const Atom&) = delete;
+        Atom& operator=(const Atom&) = delete;
+
+        /**
+         * \brief   Returns the atom for name, creating it if needed, or nullptr if name cannot be interned.
+         */
+        static const Atom *Intern(StringView name);
+
+        /**
+         * \brief   Returns the atom for name if one exists, without creating it.
+         */
+        static const Atom *Find(StringView name) noexcept;
+
+        const ara::rest::String &GetName() const noexcept
+        {
+            return name_;
+        }
+
+    private:
+        Atom(std::uint64_t hash, StringView name);
+
+        static const Atom *Find(StringView name, std::uint64_t hash) noexcept;
+
+        std::uint64_t hash_;
+        ara::rest::String name_;
+    };
+
+}
+}
+}
+
+#endif //REST_ATOM_H
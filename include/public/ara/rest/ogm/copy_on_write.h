@@ -0,0 +1,107 @@
+#ifndef REST_COPY_ON_WRITE_H
+#define REST_COPY_ON_WRITE_H
+
+#include <atomic>
+#include <memory>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   Copy-on-write holder for the contents of a container node.
+     *
+     * Copies of a holder share one T, which makes copying a container O(1). Write() gives the holder a T of its
+     * own first, copying the shared one unless no other holder refers to it any more; T's copy constructor decides
+     * how deep that copy goes. An empty holder allocates nothing until it is written to.
+     *
+     * Expose() is Write() for members that hand out mutable references into the contents. Those references may
+     * outlive any later copy, so an exposed holder is never shared again: copying it copies its T instead, and
+     * the copy is unexposed. A shared T is never modified, so holders that share it may be read and written
+     * from different threads.
+     */
+    template <typename T>
+    class CopyOnWrite
+    {
+    public:
+        CopyOnWrite() = default;
+
+        CopyOnWrite(const CopyOnWrite &other) : data_(other.Share())
+        {
+        }
+
+        CopyOnWrite &operator=(const CopyOnWrite &other)
+        {
+            data_ = other.Share();
+            exposed_ = false;
+            return *this;
+        }
+
+        CopyOnWrite(CopyOnWrite&&) noexcept = default;
+        CopyOnWrite &operator=(CopyOnWrite&&) noexcept = default;
+
+        const T &Read() const noexcept
+        {
+            return data_ ? *data_ : Empty();
+        }
+
+        T &Write()
+        {
+            if (!data_)             data_ = std::make_shared<T>();
+            else if (IsShared())    data_ = std::make_shared<T>(*data_);
+
+            return *data_;
+        }
+
+        T &Expose()
+        {
+            T &data = Write();
+            exposed_ = true;
+            return data;
+        }
+
+        /**
+         * \brief   Replaces the contents, leaving any other holder of the old ones untouched.
+         */
+        void Reset(std::shared_ptr<T> data = nullptr) noexcept
+        {
+            data_ = std::move(data);
+            exposed_ = false;
+        }
+
+        /**
+         * \brief   Returns true if another holder refers to the same contents.
+         */
+        bool IsShared() const noexcept
+        {
+            if (data_.use_count() > 1) return true;
+
+            // Pairs with the release in the decrement of the last other holder, whose reads must be complete.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return false;
+        }
+
+    private:
+        std::shared_ptr<T> Share() const
+        {
+            return exposed_ && data_ ? std::make_shared<T>(*data_) : data_;
+        }
+
+        static const T &Empty() noexcept
+        {
+            static const T empty;
+            return empty;
+        }
+
+        std::shared_ptr<T> data_;
+        bool exposed_ = false;
+    };
+
+}
+}
+}
+
+#endif //REST_COPY_ON_WRITE_H
@@ -1,10 +1,13 @@
 #ifndef REST_FIELD_H
 #define REST_FIELD_H
 
+#include <ara/rest/ogm/atom.h>
 #include <ara/rest/ogm/node.h>
 #include <ara/rest/ogm/value.h>
 #include <ara/rest/support_type.h>
 
+#include <memory>
+
 namespace ara
 {
 namespace rest
@@ -49,11 +52,41 @@ namespace ogm
         /**
          * \brief   Return the name of a Field. Fields names are immutable.
          *
+         * A name borrowed from a source buffer is copied the first time it is requested here; GetNameView() never
+         * copies it.
+         *
          * \satisfy [SWS_REST_02068] Syntax Requirement for ara::rest::ogm::Field::GetName.
          */
         const KeyType& GetName() const noexcept
         {
-            return name_;
+            if (atom_) return atom_->GetName();
+            if (!source_) return name_;
+
+            std::shared_ptr<const KeyType> copy = std::atomic_load(&copy_);
+            if (!copy)
+            {
+                auto made = std::make_shared<const KeyType>(nameView_);
+                if (std::atomic_compare_exchange_strong(&copy_, &copy, made)) copy = std::move(made);
+            }
+
+            return *copy;
+        }
+
+        /**
+         * \brief   Returns the name without copying it. An interned name points into its Atom, a borrowed name
+         *          into its source buffer.
+         */
+        StringView GetNameView() const noexcept
+        {
+            return source_ || atom_ ? nameView_ : StringView(name_);
+        }
+
+        /**
+         * \brief   Returns the interned name, or nullptr if the name could not be interned (see Atom).
+         */
+        const Atom *GetAtom() const noexcept
+        {
+            return atom_;
         }
 
         /**
@@ -104,20 +137,65 @@ namespace ogm
     public:
         Field *Copy() const override
         {
-            return new Field(name_, std::move(ogm::Copy(value_)));
+            if (atom_) return new Field(atom_, ogm::Copy(value_));
+            if (source_) return new Field(source_, nameView_, ogm::Copy(value_));
+
+            return new Field(SharedBuffer(), name_, ogm::Copy(value_));
         }
 
     public:
+        /**
+         * Holds the name only if it is neither interned nor borrowed.
+         */
         KeyType name_;
         Pointer<ValueType> value_;
 
+    private:
+        SharedBuffer source_;
+        StringView nameView_;
+        const Atom *atom_ = nullptr;
+
+        /**
+         * Copy of a borrowed name made by GetName(). It is published atomically, so concurrent readers agree on one.
+         */
+        mutable std::shared_ptr<const KeyType> copy_;
+
+    public:
+
         /**
-         * \brief   Constructs a Field.
+         * \brief   Constructs a Field. Its name is interned if possible, and copied otherwise.
          *
          * \satisfy [SWS_REST_02075] Syntax Requirement for Constructor.
          */
         Field(const std::string& name, Pointer<ValueType>&& value = Pointer<ValueType>())
-                : Node(NodeType::Field), name_(name), value_(std::move(value)) {}
+                : Node(NodeType::Field), value_(std::move(value)), atom_(Atom::Intern(name))
+        {
+            if (atom_) nameView_ = atom_->GetName();
+            else name_ = name;
+        }
+
+        /**
+         * \brief   Constructs a Field for a name read from a payload. The name uses an existing Atom if there is one,
+         *          and is otherwise borrowed from source, or copied if source is empty. It never creates an Atom, so
+         *          untrusted input cannot fill the table.
+         */
+        Field(SharedBuffer source, StringView name, Pointer<ValueType>&& value)
+                : Node(NodeType::Field), value_(std::move(value)), atom_(Atom::Find(name))
+        {
+            if (atom_) nameView_ = atom_->GetName();
+            else if (source)
+            {
+                source_ = std::move(source);
+                nameView_ = name;
+            }
+            else name_ = ara::rest::String(name);
+        }
+
+        /**
+         * \brief   Constructs a Field with an already interned name.
+         */
+        Field(const Atom *atom, Pointer<ValueType>&& value)
+                : Node(NodeType::Field), value_(std::move(value)), nameView_(atom->GetName()), atom_(atom) {}
     };
 
 }
@@ -0,0 +1,41 @@
+#ifndef REST_HASH_H
+#define REST_HASH_H
+
+#include <cstdint>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+    class Value;
+    class Object;
+    class Projection;
+
+    /**
+     * \brief   Computes a 64-bit structural hash of a value in one pass, without serializing it.
+     *
+     * Object members are hashed in the order of their canonical JSON (see JsonSerializer::SerializeCanonical),
+     * so values hash equally exactly when their canonical JSON is equal, barring collisions. Ints, Reals and Strings are kept apart even if
+     * they print alike. The hash is meant for change detection such as ETags; it is not cryptographic.
+     */
+    std::uint64_t Hash(const Value &value);
+
+    /**
+     * \brief   Hashes only the members of object that projection selects.
+     */
+    std::uint64_t Hash(const Object &object, const Projection &projection);
+
+    /**
+     * \brief   Hashes a byte string, continuing from seed. Used to mix context such as a media type into a hash.
+     */
+    std::uint64_t Hash(StringView data, std::uint64_t seed) noexcept;
+
+}
+}
+}
+
+#endif //REST_HASH_H
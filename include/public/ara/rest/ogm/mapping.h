@@ -0,0 +1,280 @@
+#ifndef OGM_MAPPING_H
+#define OGM_MAPPING_H
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ara/rest/support_type.h>
+#include <ara/rest/ogm/serializer/serializer_registry.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   One mapped member of a struct: the field name on the wire and the member it is read from and written to.
+     */
+    template <typename T, typename M>
+    struct MappedField
+    {
+        StringView name;
+        M T::*member;
+    };
+
+    template <typename T, typename M>
+    constexpr MappedField<T, M> Map(StringView name, M T::*member)
+    {
+        return MappedField<T, M>{ name, member };
+    }
+
+    /**
+     * \brief   Declares the fields of a struct once, so that it can be serialized and deserialized directly,
+     *          without building an intermediate OGM tree:
+     *
+     *              template <> struct ara::rest::ogm::Mapping<Status>
+     *              {
+     *                  static constexpr auto fields = std::make_tuple(Map("uptime", &Status::uptime),
+     *                                                                 Map("name", &Status::name));
+     *              };
+     *
+     * Members may be integers, floating point numbers, bool, ara::rest::String, std::vector of a supported type,
+     * or another mapped struct. Unknown fields are skipped on input; missing fields keep their current value.
+     */
+    template <typename T>
+    struct Mapping;
+
+    template <typename T, typename = void>
+    struct IsMapped : std::false_type {};
+
+    template <typename T>
+    struct IsMapped<T, std::void_t<decltype(Mapping<T>::fields)>> : std::true_type {};
+
+    /**
+     * \brief   Per-type encoding over a codec's struct writer and reader.
+     */
+    template <typename T, typename = void>
+    struct MappedValue
+    {
+        static_assert(IsMapped<T>::value, "type has no ara::rest::ogm::Mapping specialization");
+
+        template <typename Writer>
+        static void Write(Writer &writer, const T &value)
+        {
+            writer.BeginObject(kSize);
+            WriteFields(writer, value, Mapping<T>::fields, std::make_index_sequence<kSize>());
+            writer.EndObject();
+        }
+
+        template <typename Reader>
+        static void Read(Reader &reader, T &value)
+        {
+            std::size_t count = reader.BeginObject();
+            StringView name;
+            for (std::size_t index = 0; reader.NextKey(count, index, name); index++)
+            {
+                if (!ReadField(reader, value, name, Mapping<T>::fields, std::make_index_sequence<kSize>())) reader.Skip();
+            }
+        }
+
+    private:
+        static constexpr std::size_t kSize = std::tuple_size<std::decay_t<decltype(Mapping<T>::fields)>>::value;
+
+        template <typename Writer, typename Fields, std::size_t... I>
+        static void WriteFields(Writer &writer, const T &value, const Fields &fields, std::index_sequence<I...>)
+        {
+            (WriteField(writer, value, std::get<I>(fields), I), ...);
+        }
+
+        template <typename Writer, typename M>
+        static void WriteField(Writer &writer, const T &value, const MappedField<T, M> &field, std::size_t index)
+        {
+            writer.WriteKey(field.name, index);
+            MappedValue<M>::Write(writer, value.*field.member);
+        }
+
+        template <typename Reader, typename Fields, std::size_t... I>
+        static bool ReadField(Reader &reader, T &value, StringView name, const Fields &fields, std::index_sequence<I...>)
+        {
+            return (ReadField(reader, value, name, std::get<I>(fields)) || ...);
+        }
+
+        template <typename Reader, typename M>
+        static bool ReadField(Reader &reader, T &value, StringView name, const MappedField<T, M> &field)
+        {
+            if (name != field.name) return false;
+
+            MappedValue<M>::Read(reader, value.*field.member);
+            return true;
+        }
+    };
+
+    template <>
+    struct MappedValue<bool>
+    {
+        template <typename Writer>
+        static void Write(Writer &writer, bool value) { writer.WriteBool(value); }
+
+        template <typename Reader>
+        static void Read(Reader &reader, bool &value) { value = reader.ReadBool(); }
+    };
+
+    template <typename T>
+    struct MappedValue<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+    {
+        template <typename Writer>
+        static void Write(Writer &writer, T value)
+        {
+            if (std::is_unsigned<T>::value && static_cast<std::uint64_t>(value) > std::numeric_limits<std::int64_t>::max())
+            {
+                throw std::invalid_argument("mapping: integer out of range");
+            }
+            writer.WriteInt(static_cast<std::int64_t>(value));
+        }
+
+        template <typename Reader>
+        static void Read(Reader &reader, T &value)
+        {
+            std::int64_t read = reader.ReadInt();
+            if (read < 0 ? (std::is_unsigned<T>::value || read < static_cast<std::int64_t>(std::numeric_limits<T>::min()))
+                         : static_cast<std::uint64_t>(read) > static_cast<std::uint64_t>(std::numeric_limits<T>::max()))
+            {
+                throw std::invalid_argument("mapping: integer out of range");
+            }
+            value = static_cast<T>(read);
+        }
+    };
+
+    template <typename T>
+    struct MappedValue<T, std::enable_if_t<std::is_floating_point<T>::value>>
+    {
+        template <typename Writer>
+        static void Write(Writer &writer, T value) { writer.WriteReal(value); }
+
+        template <typename Reader>
+        static void Read(Reader &reader, T &value) { value = static_cast<T>(reader.ReadReal()); }
+    };
+
+    template <>
+    struct MappedValue<ara::rest::String>
+    {
+        template <typename Writer>
+        static void Write(Writer &writer, const ara::rest::String &value) { writer.WriteString(value); }
+
+        template <typename Reader>
+        static void Read(Reader &reader, ara::rest::String &value) { reader.ReadString(value); }
+    };
+
+    template <typename T>
+    struct MappedValue<std::vector<T>>
+    {
+        template <typename Writer>
+        static void Write(Writer &writer, const std::vector<T> &values)
+        {
+            writer.BeginArray(values.size());
+            for (std::size_t index = 0; index < values.size(); index++)
+            {
+                writer.WriteElement(index);
+                MappedValue<T>::Write(writer, values[index]);
+            }
+            writer.EndArray();
+        }
+
+        template <typename Reader>
+        static void Read(Reader &reader, std::vector<T> &values)
+        {
+            values.clear();
+
+            std::size_t count = reader.BeginArray();
+            if (count != StringView::npos) values.reserve(std::min<std::size_t>(count, 1024));
+
+            for (std::size_t index = 0; reader.NextElement(count, index); index++)
+            {
+                T value{};
+                MappedValue<T>::Read(reader, value);
+                values.push_back(std::move(value));
+            }
+        }
+    };
+
+    /**
+     * \brief   Serializes a mapped struct with the codec selected by contentType.
+     */
+    template <typename T>
+    void SerializeStruct(const T &value, OutputSink &sink, StringView contentType = "application/json")
+    {
+        StringView mediaType = SerializerRegistry::GetMediaType(contentType);
+
+        if (mediaType == "application/cbor")
+        {
+            CborStructWriter writer(sink);
+            MappedValue<T>::Write(writer, value);
+        }
+        else if (mediaType == "application/msgpack")
+        {
+            MsgPackStructWriter writer(sink);
+            MappedValue<T>::Write(writer, value);
+        }
+        else
+        {
+            JsonStructWriter writer(sink);
+            MappedValue<T>::Write(writer, value);
+        }
+    }
+
+    template <typename T>
+    ara::rest::String SerializeStruct(const T &value, StringView contentType = "application/json")
+    {
+        ara::rest::String binary;
+        OutputSink sink(binary);
+        SerializeStruct(value, sink, contentType);
+
+        return binary;
+    }
+
+    /**
+     * \brief   Deserializes into a mapped struct with the codec selected by contentType.
+     */
+    template <typename T>
+    void DeserializeStruct(StringView binary, T &value, StringView contentType = "application/json")
+    {
+        StringView mediaType = SerializerRegistry::GetMediaType(contentType);
+
+        if (mediaType == "application/cbor")
+        {
+            CborStructReader reader(binary);
+            MappedValue<T>::Read(reader, value);
+        }
+        else if (mediaType == "application/msgpack")
+        {
+            MsgPackStructReader reader(binary);
+            MappedValue<T>::Read(reader, value);
+        }
+        else
+        {
+            JsonStructReader reader(binary);
+            MappedValue<T>::Read(reader, value);
+        }
+    }
+
+    template <typename T>
+    T DeserializeStruct(StringView binary, StringView contentType = "application/json")
+    {
+        T value{};
+        DeserializeStruct(binary, value, contentType);
+
+        return value;
+    }
+
+}
+}
+}
+
+#endif //OGM_MAPPING_H
@@ -3,8 +3,9 @@
 
 #include <ara/rest/support_type.h>
 #include <ara/rest/ogm/util.h>
+#include <ara/rest/ogm/arena.h>
 #include <ara/rest/ogm/serializer/serializer.h>
-#include <ara/rest/ogm/serializer/serializer_factory.h>
+#include <ara/rest/ogm/serializer/serializer_registry.h>
 
 namespace ara
 {
@@ -60,6 +61,19 @@ namespace ogm
 
         virtual ~Node() = default;
 
+        /**
+         * \brief   Nodes come from the active Arena of the creating thread, if any, otherwise from the heap.
+         */
+        static void *operator new(std::size_t size)
+        {
+            return Arena::Allocate(size);
+        }
+
+        static void operator delete(void *memory) noexcept
+        {
+            Arena::Deallocate(memory);
+        }
+
     public:
         /**
          * \brief   Returns a (strongly-typed) pointer to its parent node.
@@ -90,9 +104,17 @@ namespace ogm
         bool IsObject() const   { return type_ == NodeType::Object; }
         bool IsField() const    { return type_ == NodeType::Field; }
 
-        ara::rest::String Serialize()
+        /**
+         * \brief   Serializes the node as JSON. The node is not modified.
+         */
+        ara::rest::String Serialize() const
+        {
+            return Serializer::Serialize(const_cast<Node*>(this));
+        }
+
+        void Serialize(OutputSink &sink) const
         {
-            return Serializer::Serialize(this);
+            Serializer::Serialize(const_cast<Node*>(this), sink);
         }
 
     protected:
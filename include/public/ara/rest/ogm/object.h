@@ -4,6 +4,8 @@
 #include <vector>
 
 #include <ara/rest/iterator.h>
+#include <ara/rest/name_index.h>
+#include <ara/rest/ogm/copy_on_write.h>
 #include <ara/rest/ogm/value.h>
 #include <ara/rest/ogm/field.h>
 #include <ara/rest/support_type.h>
@@ -103,9 +105,12 @@ namespace ogm
         /**
          * \brief   Searches for a field of the given name. If the given field name is not found, the return value will be equal to GetFields().end().
          *
+         * Copies fields shared with a copy of this object, as the result allows modifying them. Lookups that only
+         * read should use the const overload or HasField(), which never copy.
+         *
          * \satisfy [SWS_REST_02116] Syntax Requirement for ara::rest::ogm::Object::Find.
          */
-        Iterator Find(std::string_view name) noexcept;
+        Iterator Find(std::string_view name);
 
         /**
          * \brief   Searches for a field of the given name. If the given field name is not found, the return value will be equal to GetFields().end().
@@ -129,14 +134,16 @@ namespace ogm
         Iterator Remove(Iterator iterator);
 
         /**
-         * \brief   Similar to Remove but does not destroy the removed element.
+         * \brief   Similar to Remove but does not destroy the removed element. Ownership of the element is
+         *          transferred to the caller; nothing is copied.
          *
          * \satisfy [SWS_REST_02120] Syntax Requirement for ara::rest::ogm::Object::Release.
          */
         std::pair<Iterator, Pointer<Field>> Release(Iterator iterator);
 
         /**
-         * \brief   Replaces an element by a new one without the destroying the old one.
+         * \brief   Replaces an element by a new one without the destroying the old one, which is moved out
+         *          and returned.
          *
          * \satisfy [SWS_REST_02121] Syntax Requirement for ara::rest::ogm::Object::Replace.
          */
@@ -150,18 +157,42 @@ namespace ogm
         void Clear();
 
     protected:
+        /**
+         * The copy is independent of this object but shares its fields until either is modified; whichever is
+         * modified first copies the fields it holds. Fields that are objects or arrays share their contents in turn,
+         * so only the modified path is ever copied. If non-const members have handed out references into the
+         * fields, which may still be used to modify them, the copy takes fields of its own straight away.
+         */
         Object *Copy() const override
         {
             auto copyed = new Object();
-            std::for_each(value_.begin(), value_.end(), [this, &copyed](const Pointer<Field> &field){
-                copyed->Insert(std::move(ogm::Copy(field)));
-            });
+            copyed->storage_ = storage_;
 
             return copyed;
         }
 
     private:
-        ValueType value_;
+        struct Storage
+        {
+            Storage() = default;
+
+            Storage(const Storage &other) : index(other.index)
+            {
+                fields.reserve(other.fields.size());
+                for (const Pointer<Field> &field : other.fields) fields.push_back(ogm::Copy(field));
+            }
+
+            ValueType fields;
+
+            /**
+             * Indexes the field names once there are NameIndex::kThreshold of them, for Find() and HasField().
+             */
+            NameIndex index;
+        };
+
+        CopyOnWrite<Storage> storage_;
+
+        static void Reindex(Storage &storage);
 
         /**
          * \brief   Connstructs an Object.
@@ -171,8 +202,9 @@ namespace ogm
         template <typename... Ts>
         Object(Pointer<Ts>&&... fields) : Value(NodeType::Object)
         {
-            int a[] = {0, (value_.push_back(std::move(fields)), 0)...};
+            int a[] = {0, (storage_.Write().fields.push_back(std::move(fields)), 0)...};
             static_cast<void>(a);
+            if (sizeof...(fields) >= NameIndex::kThreshold) Reindex(storage_.Write());
         }
     };
 
@@ -0,0 +1,134 @@
+#ifndef REST_PROJECTION_H
+#define REST_PROJECTION_H
+
+#include <initializer_list>
+#include <vector>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+    class Value;
+    class Object;
+    class Array;
+
+    /**
+     * \brief   Set of paths that selects part of a document, e.g. { "/vehicle/id", "/vehicles/0/position" }.
+     *
+     * Paths are JSON pointers (RFC 6901). A path selects the whole subtree it names; containers on the way
+     * to it are kept with only their selected members. On arrays a numeric path segment is an element index;
+     * any other segment applies to every element, so "/items/id" selects the id of each element of items.
+     * An empty projection selects nothing; the pointer "" selects the whole document.
+     */
+    class Projection
+    {
+    public:
+        class Node
+        {
+        public:
+            /**
+             * \brief   Returns the child for an object member name or array index, or nullptr if nothing below
+             *          it is selected.
+             */
+            const Node *Find(StringView name) const noexcept;
+
+            /**
+             * \brief   Returns the child for an array element: the one named by its index, or else this node itself
+             *          if it names object members, which then apply to each element. Returns nullptr otherwise.
+             */
+            const Node *FindElement(std::size_t index) const noexcept;
+
+            /**
+             * \brief   Returns true if the whole subtree is selected.
+             */
+            bool IsSelected() const noexcept
+            {
+                return selected_;
+            }
+
+        private:
+            friend Projection;
+
+            Node &Insert(ara::rest::String &&name);
+
+            ara::rest::String name_;
+            bool selected_ = false;
+            bool named_ = false;
+            std::vector<Node> children_;
+        };
+
+    public:
+        Projection() = default;
+
+        /**
+         * \brief   Constructs a projection from JSON pointers. Throws std::invalid_argument on a malformed pointer.
+         */
+        Projection(std::initializer_list<StringView> pointers);
+
+        /**
+         * \brief   Constructs a projection from a field list such as "id,position.lat": comma-separated paths whose
+         *          segments are separated by dots. Throws std::invalid_argument on an empty path or segment.
+         */
+        static Projection FromFieldList(StringView fields);
+
+    public:
+        /**
+         * \brief   Adds a JSON pointer. Throws std::invalid_argument on a malformed pointer.
+         */
+        void Add(StringView pointer);
+
+        bool IsEmpty() const noexcept
+        {
+            return !root_.selected_ && root_.children_.empty();
+        }
+
+        const Node &GetRoot() const noexcept
+        {
+            return root_;
+        }
+
+        /**
+         * \brief   Removes every member of an already built object that the projection does not select.
+         *          Used for codecs that cannot skip unselected subtrees while parsing.
+         */
+        void Apply(Object &object) const;
+
+        /**
+         * \brief   Returns the node that applies to an object member, or nullptr if the member is not selected.
+         *          A path that ends above a scalar does not select it.
+         */
+        static const Node *Select(const Node &node, StringView name, const Value &value) noexcept;
+
+        /**
+         * \brief   Returns the node that applies to an array element, or nullptr if the element is not selected.
+         */
+        static const Node *Select(const Node &node, std::size_t index, const Value &value) noexcept;
+
+        /**
+         * \brief   Returns the node that applies to a packed element of an array, which is always a scalar.
+         */
+        static const Node *Select(const Node &node, std::size_t index) noexcept;
+
+        /**
+         * \brief   Returns the number of members of object that node selects. Codecs that prefix containers with
+         *          their size need it before writing a projected object.
+         */
+        static std::size_t Count(const Object &object, const Node &node) noexcept;
+        static std::size_t Count(const Array &array, const Node &node) noexcept;
+
+    private:
+        static void Apply(Object &object, const Node &node);
+        static void Apply(Array &array, const Node &node);
+
+        Node root_;
+    };
+
+}
+}
+}
+
+#endif //REST_PROJECTION_H
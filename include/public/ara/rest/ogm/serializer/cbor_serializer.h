@@ -0,0 +1,141 @@
+#ifndef REST_CBOR_SERIALIZER_H
+#define REST_CBOR_SERIALIZER_H
+
+#include <ara/rest/ogm/serializer/serializer.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+    class CborStructWriter;
+    class CborStructReader;
+
+    /**
+     * \brief   Concise Binary Object Representation (RFC 8949) codec, selected by "application/cbor".
+     *
+     * Reals are written as single precision whenever that is lossless and as double precision otherwise.
+     * The simple values false, true and null are mapped to and from the same Strings the JSON parser uses.
+     */
+    class CborSerializer : public Serializer
+    {
+    public:
+        using Serializer::Serializer;
+
+        void Serialize(ogm::Value &node, OutputSink &sink) override;
+        void Serialize(ogm::Int &node, OutputSink &sink) override;
+        void Serialize(ogm::Real &node, OutputSink &sink) override;
+        void Serialize(ogm::String &node, OutputSink &sink) override;
+        void Serialize(ogm::Array &node, OutputSink &sink) override;
+        void Serialize(ogm::Object &node, OutputSink &sink) override;
+        void Serialize(ogm::Field &node, OutputSink &sink) override;
+        void Serialize(ogm::Value &node, const Projection::Node &projection, OutputSink &sink) override;
+        void Serialize(ogm::Array &node, const Projection::Node &projection, OutputSink &sink) override;
+        void Serialize(ogm::Object &node, const Projection::Node &projection, OutputSink &sink) override;
+
+    protected:
+        Pointer<Value> DeserializeToValue(const ara::rest::String &binary) override;
+        Pointer<Int> DeserializeToInt(const ara::rest::String &binary) override;
+        Pointer<Real> DeserializeToReal(const ara::rest::String &binary) override;
+        Pointer<String> DeserializeToString(const ara::rest::String &binary) override;
+        Pointer<ara::rest::ogm::Array> DeserializeToArray(const ara::rest::String &binary) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const ara::rest::String &binary) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const SharedBuffer &binary) override;
+        Pointer<ara::rest::ogm::Field> DeserializeToField(const ara::rest::String &binary) override;
+
+    private:
+        friend SerializerRegistry;
+        friend CborStructWriter;
+        friend CborStructReader;
+        CborSerializer() = default;
+
+        struct Head
+        {
+            std::uint8_t major;
+            std::uint8_t info;
+            std::uint64_t argument;
+        };
+
+        static void WriteHead(std::uint8_t major, std::uint64_t argument, OutputSink &sink);
+        static void WriteInt(std::int64_t value, OutputSink &sink);
+        static void WriteReal(long double value, OutputSink &sink);
+        static void WriteCell(const ara::rest::ogm::Array &array, std::size_t index, OutputSink &sink);
+        static void WriteText(StringView text, OutputSink &sink);
+
+        static Head ReadHead(StringView &cursor);
+        static StringView ReadBytes(StringView &cursor, std::uint64_t size);
+
+        /**
+         * \brief   depth counts the containers and tags enclosing the value; one at kMaxDepth is rejected.
+         */
+        Pointer<Value> ParseValue(StringView &cursor, const SharedBuffer &source, std::size_t depth);
+        Pointer<Value> ParseValue(StringView &cursor, const Head &head, const SharedBuffer &source, std::size_t depth);
+        Pointer<String> ParseString(StringView &cursor, const Head &head, const SharedBuffer &source);
+        Pointer<ara::rest::ogm::Array> ParseArray(StringView &cursor, const Head &head, const SharedBuffer &source, std::size_t depth);
+        void ParseElement(StringView &cursor, const SharedBuffer &source, ara::rest::ogm::Array &array, std::size_t depth);
+        Pointer<ara::rest::ogm::Object> ParseObject(StringView &cursor, const Head &head, const SharedBuffer &source, std::size_t depth);
+        Pointer<ara::rest::ogm::Field> ParseField(StringView &cursor, const SharedBuffer &source, std::size_t depth);
+        static Pointer<Value> ParseSimple(const Head &head);
+    };
+
+    /**
+     * \brief   Writes mapped structs as CBOR without building an OGM tree. See ogm/mapping.h.
+     */
+    class CborStructWriter
+    {
+    public:
+        explicit CborStructWriter(OutputSink &sink) : sink_(sink) {}
+
+        void WriteInt(std::int64_t value);
+        void WriteReal(long double value);
+        void WriteBool(bool value);
+        void WriteString(StringView value);
+
+        void BeginObject(std::size_t size);
+        void WriteKey(StringView name, std::size_t index);
+        void EndObject() {}
+
+        void BeginArray(std::size_t size);
+        void WriteElement(std::size_t) {}
+        void EndArray() {}
+
+    private:
+        OutputSink &sink_;
+    };
+
+    /**
+     * \brief   Reads mapped structs from CBOR without building an OGM tree. See ogm/mapping.h.
+     *
+     * Begin* return the container size, or StringView::npos for indefinite-length containers.
+     */
+    class CborStructReader
+    {
+    public:
+        explicit CborStructReader(StringView binary) : cursor_(binary) {}
+
+        std::int64_t ReadInt();
+        long double ReadReal();
+        bool ReadBool();
+        void ReadString(ara::rest::String &value);
+
+        std::size_t BeginObject();
+        bool NextKey(std::size_t size, std::size_t index, StringView &name);
+
+        std::size_t BeginArray();
+        bool NextElement(std::size_t size, std::size_t index);
+
+        void Skip();
+
+    private:
+        void ReadText(const CborSerializer::Head &head, ara::rest::String &value);
+
+        StringView cursor_;
+        ara::rest::String name_;
+    };
+
+}
+}
+}
+
+#endif //REST_CBOR_SERIALIZER_H
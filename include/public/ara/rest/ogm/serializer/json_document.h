@@ -0,0 +1,166 @@
+#ifndef REST_JSON_DOCUMENT_H
+#define REST_JSON_DOCUMENT_H
+
+#include <mutex>
+#include <vector>
+
+#include <ara/rest/support_type.h>
+#include <ara/rest/ogm/int.h>
+#include <ara/rest/ogm/real.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/projection.h>
+#include <ara/rest/ogm/serializer/json_structural_index.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+    class JsonView;
+    class JsonSerializer;
+
+    /**
+     * \brief   Raw JSON payload that is parsed on demand.
+     *
+     * The structural index is built on first navigation; afterwards only the subtrees reached through a
+     * JsonView are parsed. Materialize() builds the complete OGM tree.
+     */
+    class JsonDocument
+    {
+    public:
+        /**
+         * \brief   HTTP bodies up to this size are kept raw for lazy access. Larger bodies and bodies of unknown
+         *          length are parsed while they are received instead of being buffered first.
+         */
+        static constexpr std::size_t kMaxLazySize = 1024 * 1024;
+
+        explicit JsonDocument(ara::rest::String &&binary) : binary_(std::make_shared<const ara::rest::String>(std::move(binary))) {}
+
+        JsonDocument(const JsonDocument&) = delete;
+        JsonDocument& operator=(const JsonDocument&) = delete;
+
+    public:
+        /**
+         * \brief   Returns a view of the top-level object, or an invalid view if GetError() reports an error.
+         */
+        JsonView GetRoot() const;
+
+        /**
+         * \brief   Returns the error found while indexing the payload: unbalanced brackets, an unterminated string
+         *          or a top-level value that is not an object. Values inside the object are only checked when a
+         *          view reaches them.
+         */
+        ErrorCode GetError() const;
+
+        /**
+         * \brief   Returns the unparsed payload.
+         */
+        const ara::rest::String &GetBinary() const noexcept
+        {
+            return *binary_;
+        }
+
+        /**
+         * \brief   Parses the whole payload into an OGM object. Its strings borrow from the document's buffer.
+         */
+        Pointer<Object> Materialize() const;
+
+        /**
+         * \brief   Parses only the members selected by projection. Unselected subtrees are skipped without being built.
+         */
+        Pointer<Object> Materialize(const Projection &projection) const;
+
+    private:
+        friend JsonView;
+
+        const JsonStructuralIndex &GetIndex() const;
+
+        static JsonSerializer &GetParser();
+
+        std::size_t GetClosing(std::size_t token) const
+        {
+            return closing_[token];
+        }
+
+        SharedBuffer binary_;
+
+        mutable std::once_flag indexed_;
+        mutable Pointer<JsonStructuralIndex> index_;
+        mutable std::vector<JsonStructuralIndex::PositionType> closing_;
+        mutable ErrorCode error_;
+    };
+
+    /**
+     * \brief   Read-only cursor into a JsonDocument. Navigating a view skips sibling subtrees without parsing them.
+     *
+     * A view obtained for a missing field or an out-of-range index is invalid; IsValid() returns false.
+     */
+    class JsonView
+    {
+    public:
+        bool IsValid() const noexcept   { return document_ != nullptr; }
+        bool IsObject() const noexcept  { return IsValid() && Front() == '{'; }
+        bool IsArray() const noexcept   { return IsValid() && Front() == '['; }
+        bool IsString() const noexcept  { return IsValid() && Front() == '"'; }
+        bool IsNumber() const noexcept;
+
+        /**
+         * \brief   Returns the number of fields of an object or elements of an array.
+         */
+        std::size_t GetSize() const;
+
+        bool HasField(StringView name) const;
+
+        /**
+         * \brief   Returns the value of the named field, or an invalid view.
+         */
+        JsonView Find(StringView name) const;
+
+        /**
+         * \brief   Returns the array element at index, or an invalid view.
+         */
+        JsonView GetValue(std::size_t index) const;
+
+        /**
+         * \brief   Returns an integer, or a real truncated towards zero. Throws std::invalid_argument for a real
+         *          outside the range of Int.
+         */
+        Int::ValueType GetInt() const;
+        Real::ValueType GetReal() const;
+        ara::rest::String GetString() const;
+
+        /**
+         * \brief   Parses the viewed subtree into an OGM value.
+         */
+        Pointer<Value> Materialize() const;
+
+    private:
+        friend JsonDocument;
+
+        JsonView() = default;
+        JsonView(const JsonDocument *document, std::size_t token, std::size_t position)
+                : document_(document), token_(token), position_(position) {}
+
+        char Front() const noexcept
+        {
+            return (*document_->binary_)[position_];
+        }
+
+        char At(std::size_t token) const;
+        bool IsEmpty() const;
+
+        JsonView MakeValue(std::size_t token) const;
+        std::size_t Next(const JsonView &value) const;
+        bool KeyEquals(std::size_t token, StringView name) const;
+
+        const JsonDocument *document_ = nullptr;
+        std::size_t token_ = 0;
+        std::size_t position_ = 0;
+    };
+
+}
+}
+}
+
+#endif //REST_JSON_DOCUMENT_H
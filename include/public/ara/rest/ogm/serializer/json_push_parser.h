@@ -0,0 +1,113 @@
+#ifndef REST_JSON_PUSH_PARSER_H
+#define REST_JSON_PUSH_PARSER_H
+
+#include <vector>
+
+#include <ara/rest/support_type.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/projection.h>
+#include <ara/rest/ogm/serializer/parse_error.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   Resumable JSON parser that builds an OGM object from body chunks as they arrive.
+     *
+     * Chunks may split the document anywhere, including inside strings and numbers; only a token that
+     * straddles a chunk boundary is buffered. Strings are always copied because chunks do not outlive Feed().
+     * Like the single-pass parser, the document must be an object and only whitespace may follow it.
+     *
+     * With a projection, subtrees it does not select are skipped by bracket depth without being built.
+     * The projection must outlive the parser.
+     */
+    class JsonPushParser
+    {
+    public:
+        explicit JsonPushParser(const Projection *projection = nullptr) : projection_(projection) {}
+
+        JsonPushParser(const JsonPushParser&) = delete;
+        JsonPushParser& operator=(const JsonPushParser&) = delete;
+
+    public:
+        /**
+         * \brief   Parses the next chunk. Returns false and sets error once the input is malformed; further chunks
+         *          are ignored.
+         */
+        bool Feed(StringView chunk, ErrorCode &error);
+
+        /**
+         * \brief   Ends the input and returns the parsed object, or an empty pointer with error set if the
+         *          document is malformed or incomplete.
+         */
+        Pointer<Object> Finish(ErrorCode &error);
+
+        /**
+         * \brief   Returns true once the closing bracket of the top-level object has been parsed.
+         */
+        bool IsComplete() const noexcept
+        {
+            return state_ == State::kDone;
+        }
+
+    private:
+        enum class State : std::uint8_t
+        {
+            kValue,
+            kValueOrClose,
+            kKey,
+            kKeyOrClose,
+            kColon,
+            kCommaOrClose,
+            kSkip,
+            kDone
+        };
+
+        /**
+         * An open container. node is the part of the projection that applies to its members, or nullptr
+         * if all of them are selected.
+         */
+        struct Frame
+        {
+            Pointer<Value> container;
+            const Projection::Node *node;
+            ara::rest::String key;
+            std::size_t index;
+        };
+
+        void Step(StringView &cursor);
+        void StepValue(StringView &cursor, char c);
+        void Skip(StringView &cursor);
+        void BeginToken(StringView &cursor, bool discard);
+        std::size_t FindTokenEnd(StringView data, std::size_t from);
+        void CompleteToken(StringView token);
+        void DiscardToken();
+
+        const Projection::Node *Resolve(bool &skip) const;
+        void Open(Pointer<Value> &&container, State state, const Projection::Node *node);
+        void Close();
+        void AddValue(Pointer<Value> &&value);
+
+        const Projection *projection_;
+        std::vector<Frame> stack_;
+        Pointer<Object> root_;
+        State state_ = State::kValue;
+        ErrorCode error_;
+        std::size_t skipDepth_ = 0;
+
+        ara::rest::String pending_;
+        bool inToken_ = false;
+        bool inString_ = false;
+        bool escaped_ = false;
+        bool discard_ = false;
+    };
+
+}
+}
+}
+
+#endif //REST_JSON_PUSH_PARSER_H
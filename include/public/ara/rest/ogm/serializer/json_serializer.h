@@ -2,6 +2,8 @@
 #define REST_JSON_SERIALIZER_H
 
 #include <ara/rest/ogm/serializer/serializer.h>
+#include <ara/rest/ogm/serializer/json_structural_index.h>
+#include <ara/rest/ogm/projection.h>
 
 namespace ara
 {
@@ -9,19 +11,38 @@ namespace rest
 {
 namespace ogm
 {
+    class JsonDocument;
+    class JsonView;
+    class JsonStructWriter;
+    class JsonStructReader;
+    class JsonPushParser;
 
     class JsonSerializer : public Serializer
     {
     public:
         using Serializer::Serializer;
 
-        ara::rest::String Serialize(ogm::Value &node) override;
-        ara::rest::String Serialize(ogm::Int &node) override;
-        ara::rest::String Serialize(ogm::Real &node) override;
-        ara::rest::String Serialize(ogm::String &node) override;
-        ara::rest::String Serialize(ogm::Array &node) override;
-        ara::rest::String Serialize(ogm::Object &node) override;
-        ara::rest::String Serialize(ogm::Field &node) override;
+        void Serialize(ogm::Value &node, OutputSink &sink) override;
+        void Serialize(ogm::Int &node, OutputSink &sink) override;
+        void Serialize(ogm::Real &node, OutputSink &sink) override;
+        void Serialize(ogm::String &node, OutputSink &sink) override;
+        void Serialize(ogm::Array &node, OutputSink &sink) override;
+        void Serialize(ogm::Object &node, OutputSink &sink) override;
+        void Serialize(ogm::Field &node, OutputSink &sink) override;
+        void Serialize(ogm::Value &node, const Projection::Node &projection, OutputSink &sink) override;
+        void Serialize(ogm::Array &node, const Projection::Node &projection, OutputSink &sink) override;
+        void Serialize(ogm::Object &node, const Projection::Node &projection, OutputSink &sink) override;
+
+        /**
+         * \brief   Writes canonical JSON: members sorted bytewise by name, no optional whitespace and numbers in their
+         *          shortest round-trip form. Equal values produce identical bytes, and ogm::Hash agrees with it.
+         */
+        static void SerializeCanonical(const Value &value, OutputSink &sink);
+
+        /**
+         * \brief   Writes canonical JSON of the members of object that projection selects.
+         */
+        static void SerializeCanonical(const Object &object, const Projection &projection, OutputSink &sink);
 
     protected:
         Pointer<Value> DeserializeToValue(const ara::rest::String &binary) override;
@@ -30,16 +51,180 @@ namespace ogm
         Pointer<String> DeserializeToString(const ara::rest::String &binary) override;
         Pointer<ara::rest::ogm::Array> DeserializeToArray(const ara::rest::String &binary) override;
         Pointer<ara::rest::ogm::Object> DeserializeToObject(const ara::rest::String &binary) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const SharedBuffer &binary) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(std::istream &stream) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const ara::rest::String &binary, ErrorCode &error) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const SharedBuffer &binary, ErrorCode &error) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(std::istream &stream, ErrorCode &error) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const ara::rest::String &binary, const Projection &projection) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(std::istream &stream, const Projection &projection) override;
         Pointer<ara::rest::ogm::Field> DeserializeToField(const ara::rest::String &binary) override;
 
     private:
-        friend SerializerFactory;
+        /**
+         * \brief   Documents of at least this size are parsed in two stages through a JsonStructuralIndex.
+         */
+        static constexpr std::size_t kStructuralIndexThreshold = 64 * 1024;
+
+        /**
+         * \brief   Upper bound of the chunks handed to a JsonPushParser when reading from a stream.
+         */
+        static constexpr std::size_t kChunkSize = 16 * 1024;
+
+        /**
+         * \brief   Top-level arrays of at least this size are split at element boundaries and parsed on several threads.
+         */
+        static constexpr std::size_t kParallelArrayThreshold = 4 * 1024 * 1024;
+
+        /**
+         * \brief   Lower bound of the elements parsed by one thread, so that small arrays are not split.
+         */
+        static constexpr std::size_t kMinElementsPerTask = 4096;
+
+        friend SerializerRegistry;
+        friend JsonDocument;
+        friend JsonView;
+        friend JsonStructWriter;
+        friend JsonStructReader;
+        friend JsonPushParser;
         JsonSerializer() = default;
 
-        bool IsInt(const ara::rest::String &jsonString);
-        bool IsReal(const ara::rest::String &jsonString);
-        bool IsArray(const ara::rest::String &jsonString);
-        bool IsObject(const ara::rest::String &jsonString);
+        static void SerializeNumber(std::int64_t value, OutputSink &sink);
+        static void SerializeNumber(long double value, OutputSink &sink);
+        static void SerializeCell(const ara::rest::ogm::Array &array, std::size_t index, OutputSink &sink);
+        static void SerializeEscaped(StringView value, OutputSink &sink);
+        static void SerializeCanonical(const Value &value, const Projection::Node *projection, OutputSink &sink);
+
+        /**
+         * \brief   Throws std::invalid_argument for a failed parse. The parser itself never throws; the throwing
+         *          entry points call this once the parse has unwound.
+         */
+        static void Check(const ErrorCode &error);
+
+        static void SkipWhitespace(StringView &cursor);
+        static bool Expect(StringView &cursor, char token, ErrorCode &error);
+
+        /**
+         * \brief   Sets kUnexpectedToken unless only whitespace is left after the top-level value.
+         */
+        static void ExpectEnd(StringView cursor, ErrorCode &error);
+        static bool AppendCodePoint(StringView &cursor, ara::rest::String &out, ErrorCode &error);
+        static StringView ScanString(StringView &cursor, bool &escaped, ErrorCode &error);
+        static ara::rest::String Unescape(StringView raw, ErrorCode &error);
+
+        /**
+         * \brief   Classifies and converts one number token in a single pass. Returns false and sets integer for
+         *          integers that fit an Int, true and sets real otherwise. Malformed tokens set error.
+         */
+        static bool ScanNumber(StringView &cursor, std::int64_t &integer, long double &real, ErrorCode &error);
+
+        template <typename T>
+        Pointer<T> ParseDocument(StringView document, const SharedBuffer &source, ErrorCode &error);
+
+        /**
+         * \brief   depth counts the containers enclosing the value; containers at kMaxDepth are rejected.
+         */
+        Pointer<Value> ParseValue(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        static Pointer<Value> ParseNumber(StringView &cursor, ErrorCode &error);
+
+        /**
+         * \brief   Parses a number straight into a packed cell of array, without creating a node for it.
+         */
+        static void ParseNumber(StringView &cursor, ara::rest::ogm::Array &array, ErrorCode &error);
+        static Pointer<Value> ParseLiteral(StringView &cursor, ErrorCode &error);
+        static ara::rest::String ParseString(StringView &cursor, ErrorCode &error);
+        Pointer<String> ParseStringValue(StringView &cursor, const SharedBuffer &source, ErrorCode &error);
+        Pointer<ara::rest::ogm::Array> ParseArray(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        Pointer<ara::rest::ogm::Object> ParseObject(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        Pointer<ara::rest::ogm::Field> ParseField(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        static Pointer<ara::rest::ogm::Object> ParseStream(std::istream &stream, const Projection *projection, ErrorCode &error);
+
+        /**
+         * \brief   Consumes one value without building it. Containers are skipped by bracket depth only; their
+         *          contents are not validated.
+         */
+        static void SkipValue(StringView &cursor, ErrorCode &error);
+
+        Pointer<ara::rest::ogm::Object> ParseProjectedDocument(StringView document, const Projection &projection,
+                                                               const SharedBuffer &source, ErrorCode &error);
+        Pointer<Value> ParseProjectedValue(StringView &cursor, const Projection::Node &node, const SharedBuffer &source,
+                                           std::size_t depth, ErrorCode &error);
+        Pointer<ara::rest::ogm::Array> ParseProjectedArray(StringView &cursor, const Projection::Node &node,
+                                                           const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        Pointer<ara::rest::ogm::Object> ParseProjectedObject(StringView &cursor, const Projection::Node &node,
+                                                             const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+
+        static Pointer<ara::rest::ogm::Field> MakeField(StringView key, bool escaped, Pointer<Value> &&value,
+                                                        const SharedBuffer &source, ErrorCode &error);
+
+        static char Peek(StringView document, const JsonStructuralIndex &index, std::size_t token, ErrorCode &error);
+
+        Pointer<Value> ParseIndexedValue(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                         std::size_t position, const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        Pointer<ara::rest::ogm::Array> ParseIndexedArray(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                                         const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        void ParseIndexedElement(StringView document, const JsonStructuralIndex &index, std::size_t &token, std::size_t position,
+                                 ara::rest::ogm::Array &array, const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        Pointer<ara::rest::ogm::Object> ParseIndexedObject(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                                           const SharedBuffer &source, std::size_t depth, ErrorCode &error);
+        Pointer<ara::rest::ogm::Array> ParseParallelArray(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                                          const SharedBuffer &source, ErrorCode &error);
+        Pointer<ara::rest::ogm::Field> ParseIndexedField(StringView &cursor, StringView document, const JsonStructuralIndex &index,
+                                                         std::size_t &token, const SharedBuffer &source, std::size_t depth,
+                                                         ErrorCode &error);
+    };
+
+    /**
+     * \brief   Writes mapped structs as JSON without building an OGM tree. See ogm/mapping.h.
+     */
+    class JsonStructWriter
+    {
+    public:
+        explicit JsonStructWriter(OutputSink &sink) : sink_(sink) {}
+
+        void WriteInt(std::int64_t value);
+        void WriteReal(long double value);
+        void WriteBool(bool value);
+        void WriteString(StringView value);
+
+        void BeginObject(std::size_t size);
+        void WriteKey(StringView name, std::size_t index);
+        void EndObject();
+
+        void BeginArray(std::size_t size);
+        void WriteElement(std::size_t index);
+        void EndArray();
+
+    private:
+        OutputSink &sink_;
+    };
+
+    /**
+     * \brief   Reads mapped structs from JSON without building an OGM tree. See ogm/mapping.h.
+     *
+     * Begin* return the container size, or StringView::npos when it is only known at its closing bracket.
+     */
+    class JsonStructReader
+    {
+    public:
+        explicit JsonStructReader(StringView binary) : cursor_(binary) {}
+
+        std::int64_t ReadInt();
+        long double ReadReal();
+        bool ReadBool();
+        void ReadString(ara::rest::String &value);
+
+        std::size_t BeginObject();
+        bool NextKey(std::size_t size, std::size_t index, StringView &name);
+
+        std::size_t BeginArray();
+        bool NextElement(std::size_t size, std::size_t index);
+
+        void Skip();
+
+    private:
+        StringView cursor_;
+        ara::rest::String name_;
     };
 
 }
@@ -0,0 +1,71 @@
+#ifndef REST_JSON_STRUCTURAL_INDEX_H
+#define REST_JSON_STRUCTURAL_INDEX_H
+
+#include <cstdint>
+#include <vector>
+
+#include <ara/rest/support_type.h>
+#include <ara/rest/ogm/serializer/parse_error.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   Stage one of the two-stage JSON parser.
+     *
+     * Records the offset of every structural character ({ } [ ] : ,) and every opening quote that lies
+     * outside a string. The document is classified 64 bytes at a time with AVX2 or SSE2 when the CPU
+     * supports it and with a scalar loop otherwise; the choice is made once at runtime.
+     */
+    class JsonStructuralIndex
+    {
+    public:
+        using PositionType = std::uint32_t;
+
+        /**
+         * \brief   Builds the index of a document. Throws std::invalid_argument on an unterminated string or a document
+         *          of 4 GiB or more, whose offsets do not fit PositionType.
+         */
+        static JsonStructuralIndex Build(StringView document);
+
+        /**
+         * \brief   Builds the index of a document. Reports the same errors through error instead of throwing.
+         */
+        static JsonStructuralIndex Build(StringView document, ErrorCode &error);
+
+        /**
+         * \brief   Returns the name of the block classifier selected for this CPU.
+         */
+        static const char *GetImplementationName() noexcept;
+
+    public:
+        const std::vector<PositionType> &GetPositions() const noexcept
+        {
+            return positions_;
+        }
+
+        std::size_t GetSize() const noexcept
+        {
+            return positions_.size();
+        }
+
+        PositionType operator[](std::size_t index) const noexcept
+        {
+            return positions_[index];
+        }
+
+    private:
+        JsonStructuralIndex() = default;
+
+        std::vector<PositionType> positions_;
+    };
+
+}
+}
+}
+
+#endif //REST_JSON_STRUCTURAL_INDEX_H
@@ -0,0 +1,169 @@
+#ifndef REST_MSGPACK_SERIALIZER_H
+#define REST_MSGPACK_SERIALIZER_H
+
+#include <istream>
+
+#include <ara/rest/ogm/serializer/serializer.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+    class MsgPackStructWriter;
+    class MsgPackStructReader;
+
+    /**
+     * \brief   MessagePack codec, selected by "application/msgpack".
+     *
+     * Integers and strings use the smallest encoding that holds them, so small integers become fixints and short
+     * strings fixstrs. Objects can be decoded straight from a stream, pulling one bounded chunk at a time.
+     */
+    class MsgPackSerializer : public Serializer
+    {
+    public:
+        using Serializer::Serializer;
+
+        void Serialize(ogm::Value &node, OutputSink &sink) override;
+        void Serialize(ogm::Int &node, OutputSink &sink) override;
+        void Serialize(ogm::Real &node, OutputSink &sink) override;
+        void Serialize(ogm::String &node, OutputSink &sink) override;
+        void Serialize(ogm::Array &node, OutputSink &sink) override;
+        void Serialize(ogm::Object &node, OutputSink &sink) override;
+        void Serialize(ogm::Field &node, OutputSink &sink) override;
+        void Serialize(ogm::Value &node, const Projection::Node &projection, OutputSink &sink) override;
+        void Serialize(ogm::Array &node, const Projection::Node &projection, OutputSink &sink) override;
+        void Serialize(ogm::Object &node, const Projection::Node &projection, OutputSink &sink) override;
+
+        bool IsStreaming() const noexcept override
+        {
+            return true;
+        }
+
+    protected:
+        Pointer<Value> DeserializeToValue(const ara::rest::String &binary) override;
+        Pointer<Int> DeserializeToInt(const ara::rest::String &binary) override;
+        Pointer<Real> DeserializeToReal(const ara::rest::String &binary) override;
+        Pointer<String> DeserializeToString(const ara::rest::String &binary) override;
+        Pointer<ara::rest::ogm::Array> DeserializeToArray(const ara::rest::String &binary) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const ara::rest::String &binary) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(const SharedBuffer &binary) override;
+        Pointer<ara::rest::ogm::Object> DeserializeToObject(std::istream &stream) override;
+        Pointer<ara::rest::ogm::Field> DeserializeToField(const ara::rest::String &binary) override;
+
+    private:
+        friend SerializerRegistry;
+        friend MsgPackStructWriter;
+        friend MsgPackStructReader;
+        MsgPackSerializer() = default;
+
+        /**
+         * \brief   Byte source over either a complete buffer or a stream read in bounded chunks.
+         *          Views returned by ReadBytes stay valid until the next read.
+         */
+        class Reader
+        {
+        public:
+            static constexpr std::size_t kChunkSize = 16 * 1024;
+
+            Reader(StringView buffer, const SharedBuffer &source);
+            explicit Reader(std::istream &stream);
+
+            std::uint8_t ReadByte();
+            std::uint64_t ReadBigEndian(std::size_t size);
+            StringView ReadBytes(std::size_t size);
+
+            /**
+             * \brief   Returns the buffer the read views point into if they may be borrowed, nullptr otherwise.
+             */
+            const SharedBuffer &GetSource() const { return source_; }
+
+        private:
+            void Fill(std::size_t size);
+
+            StringView window_;
+            SharedBuffer source_;
+            std::istream *stream_ = nullptr;
+            ara::rest::String staging_;
+        };
+
+        static void WriteInt(std::int64_t value, OutputSink &sink);
+        static void WriteReal(long double value, OutputSink &sink);
+        static void WriteCell(const ara::rest::ogm::Array &array, std::size_t index, OutputSink &sink);
+        static void WriteBigEndian(std::uint8_t marker, std::uint64_t value, std::size_t size, OutputSink &sink);
+        static void WriteHead(std::uint8_t fixBase, std::uint64_t fixLimit, std::uint8_t marker16, std::uint64_t size,
+                              OutputSink &sink);
+        static void WriteText(StringView text, OutputSink &sink);
+
+        /**
+         * \brief   depth counts the containers enclosing the value; containers at kMaxDepth are rejected.
+         */
+        Pointer<Value> ParseValue(Reader &reader, std::size_t depth);
+        Pointer<Value> ParseValue(Reader &reader, std::uint8_t marker, std::size_t depth);
+        Pointer<String> ParseString(Reader &reader, std::uint64_t size);
+        Pointer<ara::rest::ogm::Array> ParseArray(Reader &reader, std::uint64_t size, std::size_t depth);
+        void ParseElement(Reader &reader, ara::rest::ogm::Array &array, std::size_t depth);
+        Pointer<ara::rest::ogm::Object> ParseObject(Reader &reader, std::uint64_t size, std::size_t depth);
+        Pointer<ara::rest::ogm::Object> ParseObject(Reader &reader);
+        Pointer<ara::rest::ogm::Field> ParseField(Reader &reader, std::size_t depth);
+    };
+
+    /**
+     * \brief   Writes mapped structs as MessagePack without building an OGM tree. See ogm/mapping.h.
+     */
+    class MsgPackStructWriter
+    {
+    public:
+        explicit MsgPackStructWriter(OutputSink &sink) : sink_(sink) {}
+
+        void WriteInt(std::int64_t value);
+        void WriteReal(long double value);
+        void WriteBool(bool value);
+        void WriteString(StringView value);
+
+        void BeginObject(std::size_t size);
+        void WriteKey(StringView name, std::size_t index);
+        void EndObject() {}
+
+        void BeginArray(std::size_t size);
+        void WriteElement(std::size_t) {}
+        void EndArray() {}
+
+    private:
+        OutputSink &sink_;
+    };
+
+    /**
+     * \brief   Reads mapped structs from MessagePack without building an OGM tree. See ogm/mapping.h.
+     */
+    class MsgPackStructReader
+    {
+    public:
+        explicit MsgPackStructReader(StringView binary) : reader_(binary, nullptr) {}
+        explicit MsgPackStructReader(std::istream &stream) : reader_(stream) {}
+
+        std::int64_t ReadInt();
+        long double ReadReal();
+        bool ReadBool();
+        void ReadString(ara::rest::String &value);
+
+        std::size_t BeginObject();
+        bool NextKey(std::size_t size, std::size_t index, StringView &name);
+
+        std::size_t BeginArray();
+        bool NextElement(std::size_t size, std::size_t index) { return index < size; }
+
+        void Skip();
+
+    private:
+        std::size_t ReadStringSize(std::uint8_t marker);
+
+        MsgPackSerializer::Reader reader_;
+    };
+
+}
+}
+}
+
+#endif //REST_MSGPACK_SERIALIZER_H
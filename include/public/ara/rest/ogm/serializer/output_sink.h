@@ -0,0 +1,110 @@
+#ifndef REST_OUTPUT_SINK_H
+#define REST_OUTPUT_SINK_H
+
+#include <ostream>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    class OutputSink
+    {
+    public:
+        /**
+         * \brief   Default capacity of the staging buffer of a stream-backed sink.
+         */
+        static constexpr std::size_t kDefaultStreamCapacity = 16 * 1024;
+
+        /**
+         * \brief   Constructs a sink that appends into a caller-supplied growable buffer.
+         */
+        explicit OutputSink(ara::rest::String &buffer) : buffer_(&buffer) {}
+
+        /**
+         * \brief   Constructs a sink that writes to a stream through a staging buffer of bounded size.
+         */
+        explicit OutputSink(std::ostream &stream, std::size_t capacity = kDefaultStreamCapacity)
+                : buffer_(&staging_), stream_(&stream), capacity_(capacity)
+        {
+            staging_.reserve(capacity);
+        }
+
+        OutputSink(const OutputSink&) = delete;
+        OutputSink& operator=(const OutputSink&) = delete;
+
+        ~OutputSink()
+        {
+            Flush();
+        }
+
+    public:
+        void Append(char c)
+        {
+            buffer_->push_back(c);
+            if (stream_ && buffer_->size() >= capacity_) Flush();
+        }
+
+        void Append(StringView data)
+        {
+            Append(data.data(), data.size());
+        }
+
+        void Append(const char *data, std::size_t size)
+        {
+            buffer_->append(data, size);
+            if (stream_ && buffer_->size() >= capacity_) Flush();
+        }
+
+        /**
+         * \brief   Reserves room for at least size more bytes. Has no effect on a stream-backed sink.
+         */
+        void Reserve(std::size_t size)
+        {
+            if (!stream_) buffer_->reserve(buffer_->size() + size);
+        }
+
+        /**
+         * \brief   Appends a separately built buffer. A stream-backed sink writes it to the stream directly instead of
+         *          staging a copy; an empty buffer-backed sink takes it over.
+         */
+        void Splice(ara::rest::String &&data)
+        {
+            if (!stream_)
+            {
+                if (buffer_->empty()) buffer_->swap(data);
+                else buffer_->append(data);
+                return;
+            }
+
+            Flush();
+            stream_->write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+
+        /**
+         * \brief   Writes the staged bytes of a stream-backed sink to its stream.
+         */
+        void Flush()
+        {
+            if (!stream_ || staging_.empty()) return;
+
+            stream_->write(staging_.data(), static_cast<std::streamsize>(staging_.size()));
+            staging_.clear();
+        }
+
+    private:
+        ara::rest::String *buffer_;
+        ara::rest::String staging_;
+        std::ostream *stream_ = nullptr;
+        std::size_t capacity_ = 0;
+    };
+
+}
+}
+}
+
+#endif //REST_OUTPUT_SINK_H
@@ -0,0 +1,51 @@
+#ifndef REST_PARSE_ERROR_H
+#define REST_PARSE_ERROR_H
+
+#include <system_error>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   Reasons a payload could not be deserialized, reported through ErrorCode by the non-throwing
+     *          Serializer::Deserialize overloads.
+     */
+    enum class ParseError
+    {
+        kUnexpectedEnd = 1,
+        kUnexpectedToken,
+        kMalformedNumber,
+        kNumberOutOfRange,
+        kUnterminatedString,
+        kInvalidEscape,
+        kMalformedStructure,
+        kTypeMismatch,
+        kMalformedInput,
+        kDocumentTooLarge,
+        kNestingTooDeep
+    };
+
+    const std::error_category &GetParseErrorCategory() noexcept;
+
+    inline ErrorCode make_error_code(ParseError error) noexcept
+    {
+        return ErrorCode(static_cast<int>(error), GetParseErrorCategory());
+    }
+
+}
+}
+}
+
+namespace std
+{
+    template <>
+    struct is_error_code_enum<ara::rest::ogm::ParseError> : true_type {};
+}
+
+#endif //REST_PARSE_ERROR_H
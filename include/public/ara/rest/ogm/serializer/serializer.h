@@ -1,7 +1,13 @@
 #ifndef REST_SERIALIZER_H
 #define REST_SERIALIZER_H
 
+#include <istream>
+
 #include <ara/rest/support_type.h>
+#include <ara/rest/ogm/util.h>
+#include <ara/rest/ogm/projection.h>
+#include <ara/rest/ogm/serializer/output_sink.h>
+#include <ara/rest/ogm/serializer/parse_error.h>
 
 namespace ara
 {
@@ -9,7 +15,7 @@ namespace rest
 {
 namespace ogm
 {
-    class SerializerFactory;
+    class SerializerRegistry;
 
     class Node;
     class Value;
@@ -23,7 +29,7 @@ namespace ogm
     class Serializer
     {
     public:
-        friend SerializerFactory;
+        friend SerializerRegistry;
         friend Value;
         friend Int;
         friend Real;
@@ -34,16 +40,100 @@ namespace ogm
 
         static ara::rest::String Serialize(ogm::Node *node);
 
+        static void Serialize(ogm::Node *node, OutputSink &sink);
+
+        /**
+         * \brief   Serializes with the codec selected by contentType.
+         */
+        static void Serialize(ogm::Node *node, OutputSink &sink, StringView contentType);
+
+        /**
+         * \brief   Serializes only the members a projection selects. The object is walked in place; no pruned copy
+         *          is built.
+         */
+        static void Serialize(ogm::Object *object, OutputSink &sink, StringView contentType, const Projection &projection);
+
+        /**
+         * \brief   Containers whose subtree holds at least this many nodes are serialized in shards on several threads.
+         */
+        static constexpr std::size_t kDefaultParallelThreshold = 256 * 1024;
+
+        /**
+         * \brief   Sets the node count above which containers are serialized in parallel. Zero disables it.
+         */
+        static void SetParallelThreshold(std::size_t nodes) noexcept;
+
+        static std::size_t GetParallelThreshold() noexcept;
+
+        /**
+         * \brief   Deepest nesting of arrays and objects the parsers accept. Deeper input is rejected with
+         *          ParseError::kNestingTooDeep before it can exhaust the stack of the recursive parsers.
+         */
+        static constexpr std::size_t kMaxDepth = 256;
+
         static Pointer<Object> Deserialize(const ara::rest::String &string);
 
+        /**
+         * \brief   Deserializes a document whose top-level value is an array, with the codec selected by contentType.
+         *          Large JSON arrays are parsed on several threads.
+         */
+        static Pointer<Array> DeserializeArray(const ara::rest::String &string, StringView contentType);
+
+        /**
+         * \brief   Deserializes with the codec selected by contentType.
+         */
+        static Pointer<Object> Deserialize(const ara::rest::String &string, StringView contentType);
+
+        /**
+         * \brief   Deserializes a shared buffer. Strings and field names may borrow their bytes from it.
+         */
+        static Pointer<Object> Deserialize(const SharedBuffer &buffer);
+
+        /**
+         * \brief   Deserializes with the codec selected by contentType, reading the stream until the document ends.
+         */
+        static Pointer<Object> Deserialize(std::istream &stream, StringView contentType);
+
+        /**
+         * \brief   Deserializes with the codec selected by contentType without throwing on malformed input.
+         *          Returns an empty pointer and sets error (see ParseError) when the payload cannot be parsed.
+         *          Any exception a codec throws while parsing is reported this way; allocation failures, such as
+         *          those caused by hostile length prefixes, become ParseError::kDocumentTooLarge.
+         */
+        static Pointer<Object> Deserialize(const ara::rest::String &string, StringView contentType, ErrorCode &error);
+
+        /**
+         * \brief   Deserializes a shared buffer without throwing on malformed input.
+         */
+        static Pointer<Object> Deserialize(const SharedBuffer &buffer, ErrorCode &error);
+
+        /**
+         * \brief   Deserializes a stream without throwing on malformed input.
+         */
+        static Pointer<Object> Deserialize(std::istream &stream, StringView contentType, ErrorCode &error);
+
+        /**
+         * \brief   Deserializes only the fields a projection selects. The JSON codec skips unselected subtrees
+         *          without building them; other codecs build the whole object and prune it.
+         */
+        static Pointer<Object> Deserialize(const ara::rest::String &string, StringView contentType, const Projection &projection);
+
+        /**
+         * \brief   Deserializes only the fields a projection selects, reading the stream until the document ends.
+         */
+        static Pointer<Object> Deserialize(std::istream &stream, StringView contentType, const Projection &projection);
+
     protected:
-        virtual ara::rest::String Serialize(ogm::Value &node) = 0;
-        virtual ara::rest::String Serialize(ogm::Int &node) = 0;
-        virtual ara::rest::String Serialize(ogm::Real &node) = 0;
-        virtual ara::rest::String Serialize(ogm::String &node) = 0;
-        virtual ara::rest::String Serialize(ogm::Array &node) = 0;
-        virtual ara::rest::String Serialize(ogm::Object &node) = 0;
-        virtual ara::rest::String Serialize(ogm::Field &node) = 0;
+        virtual void Serialize(ogm::Value &node, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Int &node, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Real &node, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::String &node, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Array &node, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Object &node, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Field &node, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Value &node, const Projection::Node &projection, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Array &node, const Projection::Node &projection, OutputSink &sink) = 0;
+        virtual void Serialize(ogm::Object &node, const Projection::Node &projection, OutputSink &sink) = 0;
 
         virtual Pointer<Value> DeserializeToValue(const ara::rest::String &binary) = 0;
         virtual Pointer<Int> DeserializeToInt(const ara::rest::String &binary) = 0;
@@ -51,11 +141,39 @@ namespace ogm
         virtual Pointer<String> DeserializeToString(const ara::rest::String &binary) = 0;
         virtual Pointer<Array> DeserializeToArray(const ara::rest::String &binary) = 0;
         virtual Pointer<Object> DeserializeToObject(const ara::rest::String &binary) = 0;
+        virtual Pointer<Object> DeserializeToObject(const SharedBuffer &binary);
+        virtual Pointer<Object> DeserializeToObject(std::istream &stream);
+        virtual Pointer<Object> DeserializeToObject(const ara::rest::String &binary, ErrorCode &error);
+        virtual Pointer<Object> DeserializeToObject(const SharedBuffer &binary, ErrorCode &error);
+        virtual Pointer<Object> DeserializeToObject(std::istream &stream, ErrorCode &error);
+        virtual Pointer<Object> DeserializeToObject(const ara::rest::String &binary, const Projection &projection);
+        virtual Pointer<Object> DeserializeToObject(std::istream &stream, const Projection &projection);
         virtual Pointer<Field> DeserializeToField(const ara::rest::String &binary) = 0;
 
+    public:
+        virtual ~Serializer() = default;
+
+        /**
+         * \brief   Returns whether replies in this codec's media type should be sent while they are encoded, with
+         *          chunked transfer encoding, rather than buffered to send a Content-Length first.
+         */
+        virtual bool IsStreaming() const noexcept
+        {
+            return false;
+        }
+
     protected:
+        static Serializer &GetSerializer(StringView contentType);
+
+        /**
+         * \brief   Writes the count children of container through write(index, sink). Above the parallel threshold,
+         *          contiguous shards of children are written into separate buffers on the WorkerPool and spliced into
+         *          sink in order, so write must only touch the sink it is given.
+         */
+        static void SerializeChildren(const Value &container, std::size_t count, OutputSink &sink,
+                                      const Function<void(std::size_t, OutputSink&)> &write);
+
         Serializer() = default;
-        virtual ~Serializer() = default;
     };
 
 }
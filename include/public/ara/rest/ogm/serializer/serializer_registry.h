@@ -0,0 +1,95 @@
+#ifndef REST_SERIALIZER_REGISTRY_H
+#define REST_SERIALIZER_REGISTRY_H
+
+#include <deque>
+#include <shared_mutex>
+
+#include <ara/rest/ogm/serializer/serializer.h>
+#include <ara/rest/ogm/serializer/json_serializer.h>
+#include <ara/rest/ogm/serializer/cbor_serializer.h>
+#include <ara/rest/ogm/serializer/msgpack_serializer.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   Process-wide table of codecs keyed by media type.
+     *
+     * JSON, CBOR and MessagePack are registered on first use; JSON is the default for unknown media types.
+     * A codec instance is shared by every thread, so registered codecs must keep no per-call state.
+     * Lookups and negotiation take a shared lock and never allocate.
+     */
+    class SerializerRegistry
+    {
+    public:
+        static SerializerRegistry &GetInstance();
+
+        SerializerRegistry(const SerializerRegistry&) = delete;
+        SerializerRegistry& operator=(const SerializerRegistry&) = delete;
+
+    public:
+        /**
+         * \brief   Registers a codec for a media type such as "application/yaml". Returns false and leaves the
+         *          registry unchanged if the media type already has a codec.
+         */
+        bool Register(StringView mediaType, Pointer<Serializer> &&codec);
+
+        /**
+         * \brief   Returns the codec for the media type of a Content-Type value, or nullptr if none is registered.
+         */
+        Serializer *Find(StringView contentType) const;
+
+        /**
+         * \brief   Returns the codec for the media type of a Content-Type value, or the JSON codec if none is registered.
+         */
+        Serializer &Get(StringView contentType) const;
+
+        /**
+         * \brief   Returns whether a codec exists for the media type of a Content-Type value.
+         */
+        bool IsSupported(StringView contentType) const
+        {
+            return Find(contentType) != nullptr;
+        }
+
+        /**
+         * \brief   Picks the registered media type an Accept header value prefers, honouring q-values.
+         *          Media types are matched case-insensitively and parameters other than q are ignored.
+         *          Falls back to "application/json" when nothing acceptable is offered. The returned view
+         *          stays valid for the lifetime of the process.
+         */
+        StringView Negotiate(StringView accept) const;
+
+        /**
+         * \brief   Strips parameters and surrounding whitespace, e.g. "application/json; charset=utf-8" -> "application/json".
+         */
+        static StringView GetMediaType(StringView contentType);
+
+    private:
+        struct Entry
+        {
+            ara::rest::String mediaType;
+            Pointer<Serializer> codec;
+        };
+
+        SerializerRegistry();
+
+        const Entry *FindEntry(StringView mediaType) const;
+
+        /**
+         * Entries are never removed and a deque never relocates its elements, so media type views handed
+         * out by Negotiate() and codec references handed out by Get() remain valid.
+         */
+        std::deque<Entry> entries_;
+        mutable std::shared_mutex mutex_;
+    };
+
+}
+}
+}
+
+#endif //REST_SERIALIZER_REGISTRY_H
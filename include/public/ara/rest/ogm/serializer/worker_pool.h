@@ -0,0 +1,71 @@
+#ifndef REST_WORKER_POOL_H
+#define REST_WORKER_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ara/rest/support_type.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * \brief   Process-wide pool of threads shared by the codecs that split work across threads.
+     *
+     * The pool starts one thread less than the hardware offers, on first use, and never grows. Concurrent
+     * callers share these threads instead of starting their own, so the number of threads the codecs use is
+     * bounded no matter how many messages are processed at once.
+     */
+    class WorkerPool
+    {
+    public:
+        static WorkerPool &GetInstance();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        ~WorkerPool();
+
+    public:
+        /**
+         * \brief   Returns how many tasks can run at once: the pool threads plus the calling thread.
+         */
+        std::size_t GetConcurrency() const noexcept
+        {
+            return workers_.size() + 1;
+        }
+
+        /**
+         * \brief   Calls task(0) to task(count - 1) and returns once all of them have finished. The calling thread
+         *          runs tasks too, and runs all of them if every pool thread is busy, so Run may be called from a
+         *          task. If tasks throw, the first exception is rethrown after all tasks have finished.
+         */
+        void Run(std::size_t count, const Function<void(std::size_t)> &task);
+
+    private:
+        struct Batch;
+
+        WorkerPool();
+
+        void Work();
+
+        std::vector<std::thread> workers_;
+        std::deque<std::shared_ptr<Batch>> queue_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        bool stopping_ = false;
+    };
+
+}
+}
+}
+
+#endif //REST_WORKER_POOL_H
@@ -45,7 +45,15 @@ namespace ogm
          */
         ValueType GetValue() const noexcept
         {
-            return value_;
+            return source_ ? ValueType(view_) : value_;
+        }
+
+        /**
+         * \brief   Returns the value without copying it. A borrowed String points into its source buffer.
+         */
+        StringView GetView() const noexcept
+        {
+            return source_ ? view_ : StringView(value_);
         }
 
         /**
@@ -56,16 +64,19 @@ namespace ogm
         void SetValue(ValueType value) noexcept
         {
             value_ = value;
+            source_.reset();
         }
 
     protected:
         String *Copy() const override
         {
-            return new String(this->value_);
+            return source_ ? new String(source_, view_) : new String(this->value_);
         }
 
     private:
         ValueType value_;
+        SharedBuffer source_;
+        StringView view_;
 
         /**
          * \brief   Connstructs an String.
@@ -73,6 +84,11 @@ namespace ogm
          * \satisfy [SWS_REST_02150] Syntax Requirement for Constructor.
          */
         String(ValueType value = ValueType{}) : Value(NodeType::String), value_(value) {};
+
+        /**
+         * \brief   Constructs a String that borrows view from source instead of owning a copy.
+         */
+        String(SharedBuffer source, StringView view) : Value(NodeType::String), source_(std::move(source)), view_(view) {};
     };
 
 }
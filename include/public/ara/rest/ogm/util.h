@@ -10,6 +10,11 @@ namespace rest
 namespace ogm
 {
 
+    /**
+     * \brief   Reference-counted input buffer. Parsed Strings and Field names may borrow their bytes from it.
+     */
+    using SharedBuffer = std::shared_ptr<const ara::rest::String>;
+
     template <typename SelfType>
     class Constructible
     {
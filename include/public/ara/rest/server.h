@@ -5,11 +5,17 @@
 #ifndef REST_SERVER_H
 #define REST_SERVER_H
 
+#include <istream>
+#include <mutex>
+
 #include <ara/rest/endpoint.h>
 #include <ara/rest/header.h>
 #include <ara/rest/uri.h>
 #include <ara/rest/support_type.h>
+#include <ara/rest/ogm/arena.h>
 #include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/serializer/json_document.h>
+#include <ara/rest/ogm/serializer/output_sink.h>
 
 namespace ara
 {
@@ -187,6 +193,23 @@ namespace rest
 
         ServerRequest() = default;
         ServerRequest(RequestMethod method, const Uri &uri, const Pointer<ogm::Object> &payload);
+        ServerRequest(RequestMethod method, const Uri &uri, Pointer<ogm::Object> &&payload);
+
+        /**
+         * \brief   Constructs a ServerRequest that keeps the raw payload and parses it on demand.
+         */
+        ServerRequest(RequestMethod method, const Uri &uri, String &&binary);
+
+        /**
+         * \brief   Constructs a ServerRequest whose payload was built inside arena. The request owns the arena.
+         */
+        ServerRequest(RequestMethod method, const Uri &uri, Pointer<ogm::Arena> &&arena, Pointer<ogm::Object> &&payload);
+
+        /**
+         * \brief   Constructs a ServerRequest that decodes its payload from stream when it is first accessed, with the
+         *          codec contentType selects. The stream must outlive the request.
+         */
+        ServerRequest(RequestMethod method, const Uri &uri, std::istream &stream, StringView contentType);
 
     public:
         /**
@@ -197,12 +220,18 @@ namespace rest
         RequestHeader const & GetHeader() const;
 
         /**
-         * \brief   Obtains the request message payload.
+         * \brief   Obtains the request message payload. A request without a body has an empty object.
          *
          * \satisfy [SWS_REST_02236] Syntax Requirement for ara::rest::ServerRequest::GetObject.
          */
         ogm::Object const& GetObject() const;
 
+        /**
+         * \brief   Obtains a lazy view of the request payload. Only the navigated subtrees are parsed. A payload
+         *          whose structure is broken gives an invalid view, and GetError() tells why.
+         */
+        ogm::JsonView GetView() const;
+
         /**
          * \brief   Obtains the reply message payload.
          *
@@ -210,6 +239,12 @@ namespace rest
          */
         Task<Pointer<ogm::Object>> ReleaseObject();
 
+        /**
+         * \brief   Obtains only the members of the request payload selected by projection. A payload that has not
+         *          been parsed yet is parsed without building the unselected subtrees.
+         */
+        Task<Pointer<ogm::Object>> ReleaseObject(const ogm::Projection &projection);
+
         /**
          * \brief   Obtains the reply message payload.
          *
@@ -217,9 +252,27 @@ namespace rest
          */
         Task<Pointer<String>> ReleaseBinary();
 
+        /**
+         * \brief   Returns the error that parsing the payload ran into, or an empty error code.
+         */
+        ErrorCode GetError() const noexcept;
+
     private:
         RequestHeader header_;
-        Pointer<ogm::Object> payload_;
+        Pointer<ogm::Arena> arena_;
+        mutable Pointer<ogm::Object> payload_;
+        mutable Pointer<ogm::JsonDocument> document_;
+        mutable std::istream *stream_ = nullptr;
+        String contentType_;
+        mutable ErrorCode error_;
+
+        /**
+         * Guards the lazily parsed members above, so that the const accessors may be called from several threads.
+         */
+        mutable std::mutex mutex_;
+
+        const ogm::Object &GetPayload() const;
+        Pointer<ogm::Object> Parse(const ogm::Projection *projection) const;
     };
 
     class ServerReply
@@ -240,6 +293,7 @@ namespace rest
         ServerReply &operator=(const ServerReply &) = delete;
 
         ServerReply(const Uri &uri, StatusCode status, const Pointer<ogm::Object> &payload);
+        ServerReply(const Uri &uri, StatusCode status, Pointer<ogm::Object> &&payload);
 
     public:
         /**
@@ -270,6 +324,18 @@ namespace rest
          */
         virtual Task<void> Send(const StringView &data) = 0;
 
+        /**
+         * \brief   Sends an object with chunked transfer encoding. It is serialized straight into the connection in
+         *          bounded chunks instead of being built in memory first.
+         */
+        virtual Task<void> SendStreamed(const Pointer<ogm::Object> &data) = 0;
+
+        /**
+         * \brief   Sends a body of the given media type with chunked transfer encoding. writer is invoked once with
+         *          a sink bound to the connection; its output leaves the host as soon as a chunk is full.
+         */
+        virtual Task<void> SendStreamed(StringView contentType, const Function<void(ogm::OutputSink&)> &writer) = 0;
+
         /**
          * \brief   Issues a redirect command to the connected client.
          *
@@ -8,6 +8,7 @@
 
 #include <ara/rest/support_type.h>
 #include <ara/rest/iterator.h>
+#include <ara/rest/name_index.h>
 
 namespace ara
 {
@@ -459,6 +460,11 @@ namespace rest
 
     private:
         std::vector<Uri::Query::Parameter> parameters_;
+
+        /**
+         * Indexes the keys of queries with at least NameIndex::kThreshold parameters.
+         */
+        NameIndex index_;
     };
 
     class Uri::Path::Segment
@@ -555,6 +561,8 @@ namespace rest
         T GetValueAs(T &&def = {}) const;
 
     private:
+        friend Query;
+
         std::string key_;
         std::string value_;
     };
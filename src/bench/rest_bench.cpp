@@ -0,0 +1,424 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sstream>
+
+#include <ara/rest/ogm/arena.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/field.h>
+#include <ara/rest/ogm/int.h>
+#include <ara/rest/ogm/real.h>
+#include <ara/rest/ogm/string.h>
+#include <ara/rest/ogm/serializer/serializer.h>
+#include <ara/rest/ogm/mapping.h>
+
+using namespace ara::rest;
+
+struct Status
+{
+    std::int64_t uptime;
+    double load;
+    String name;
+    bool healthy;
+    std::vector<std::int64_t> ports;
+};
+
+template <>
+struct ara::rest::ogm::Mapping<Status>
+{
+    static constexpr auto fields = std::make_tuple(ogm::Map("uptime", &Status::uptime),
+                                                   ogm::Map("load", &Status::load),
+                                                   ogm::Map("name", &Status::name),
+                                                   ogm::Map("healthy", &Status::healthy),
+                                                   ogm::Map("ports", &Status::ports));
+};
+
+namespace
+{
+    std::atomic<std::size_t> allocations{ 0 };
+
+    void *Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        if (alignment <= alignof(std::max_align_t)) return std::malloc(size ? size : 1);
+
+        // aligned_alloc wants a size that is a multiple of the alignment.
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    void *AllocateOrThrow(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        if (void *memory = Allocate(size, alignment)) return memory;
+        throw std::bad_alloc();
+    }
+}
+
+/**
+ * Counts every heap allocation so that each benchmark can report allocations per operation. Every form of
+ * operator new is replaced, so that each operator delete below frees memory from the matching allocator.
+ */
+void *operator new(std::size_t size) { return AllocateOrThrow(size); }
+void *operator new[](std::size_t size) { return AllocateOrThrow(size); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return AllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return AllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return Allocate(size); }
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return Allocate(size); }
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return Allocate(size, static_cast<std::size_t>(alignment)); }
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return Allocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete[](void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept { std::free(memory); }
+
+namespace
+{
+    const char *filter = nullptr;
+
+    /**
+     * \brief   Returns true if a section is selected by the command line filter (a substring of its name).
+     */
+    bool Selected(const char *section)
+    {
+        return !filter || std::strstr(section, filter);
+    }
+
+    /**
+     * \brief   Runs body repeatedly for at least kMinimumDuration and prints the mean time, the throughput over
+     *          bytes per operation (if any) and the mean number of heap allocations.
+     */
+    template<typename Body>
+    void Run(const char *name, std::size_t bytes, Body body)
+    {
+        constexpr auto kMinimumDuration = std::chrono::milliseconds(500);
+
+        std::size_t iterations = 0;
+        std::size_t allocated = allocations.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::steady_clock::duration::zero();
+        do
+        {
+            body();
+            iterations++;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (elapsed < kMinimumDuration);
+        allocated = allocations.load(std::memory_order_relaxed) - allocated;
+
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        if (bytes)
+        {
+            std::printf("%-32s %12.2f us/op %10.1f MB/s %12.1f allocs/op\n", name, seconds * 1e6 / iterations,
+                        bytes * iterations / seconds / 1e6, static_cast<double>(allocated) / iterations);
+        }
+        else
+        {
+            std::printf("%-32s %12.2f us/op %15s %12.1f allocs/op\n", name, seconds * 1e6 / iterations, "",
+                        static_cast<double>(allocated) / iterations);
+        }
+    }
+
+    /**
+     * \brief   One object with many scalar members.
+     */
+    Pointer<ogm::Object> MakeFlat(std::size_t fields)
+    {
+        auto document = ogm::Object::Make();
+        for (std::size_t i = 0; i < fields; i++)
+        {
+            String name = "field" + std::to_string(i);
+            if (i % 2) document->Insert(ogm::Field::Make(name, ogm::Int::Make(static_cast<ogm::Int::ValueType>(i))));
+            else document->Insert(ogm::Field::Make(name, ogm::String::Make("value-" + std::to_string(i))));
+        }
+        return document;
+    }
+
+    /**
+     * \brief   A chain of nested objects, each with a couple of scalars next to the child.
+     */
+    Pointer<ogm::Object> MakeDeep(std::size_t depth)
+    {
+        auto document = ogm::Object::Make();
+        document->Insert(ogm::Field::Make("level", ogm::Int::Make(static_cast<ogm::Int::ValueType>(depth))));
+        document->Insert(ogm::Field::Make("label", ogm::String::Make("leaf")));
+        for (std::size_t i = depth; i > 0; i--)
+        {
+            auto parent = ogm::Object::Make();
+            parent->Insert(ogm::Field::Make("level", ogm::Int::Make(static_cast<ogm::Int::ValueType>(i - 1))));
+            parent->Insert(ogm::Field::Make("label", ogm::String::Make("node")));
+            parent->Insert(ogm::Field::Make("child", std::move(document)));
+            document = std::move(parent);
+        }
+        return document;
+    }
+
+    /**
+     * \brief   Arrays of integers and reals, the shape of sampled sensor data.
+     */
+    Pointer<ogm::Object> MakeNumeric(std::size_t count)
+    {
+        auto integers = ogm::Array::Make();
+        auto reals = ogm::Array::Make();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            integers->Append(ogm::Int::Make(static_cast<ogm::Int::ValueType>(i * 7919 % 1000003) - 500000));
+            reals->Append(ogm::Real::Make(i * 0.001L + 1.0L / (i + 3)));
+        }
+
+        auto document = ogm::Object::Make();
+        document->Insert(ogm::Field::Make("integers", std::move(integers)));
+        document->Insert(ogm::Field::Make("reals", std::move(reals)));
+        return document;
+    }
+
+    /**
+     * \brief   An array of long strings, some of which need escaping.
+     */
+    Pointer<ogm::Object> MakeStrings(std::size_t count)
+    {
+        auto strings = ogm::Array::Make();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            String text(200, static_cast<char>('a' + i % 26));
+            if (i % 4 == 0) text += "\"quoted\"\tand\\escaped\n";
+            strings->Append(ogm::String::Make(std::move(text)));
+        }
+
+        auto document = ogm::Object::Make();
+        document->Insert(ogm::Field::Make("strings", std::move(strings)));
+        return document;
+    }
+
+    Pointer<ogm::Object> MakeDocument(std::size_t records)
+    {
+        auto items = ogm::Array::Make();
+        for (std::size_t i = 0; i < records; i++)
+        {
+            auto tags = ogm::Array::Make();
+            tags->Append(ogm::String::Make("alpha"));
+            tags->Append(ogm::String::Make("beta"));
+
+            auto item = ogm::Object::Make();
+            item->Insert(ogm::Field::Make("id", ogm::Int::Make(static_cast<ogm::Int::ValueType>(i))));
+            item->Insert(ogm::Field::Make("small", ogm::Int::Make(static_cast<ogm::Int::ValueType>(i % 100))));
+            item->Insert(ogm::Field::Make("ratio", ogm::Real::Make(i * 0.25L)));
+            item->Insert(ogm::Field::Make("name", ogm::String::Make("record-" + std::to_string(i))));
+            item->Insert(ogm::Field::Make("active", ogm::String::Make(i % 2 ? "true" : "false")));
+            item->Insert(ogm::Field::Make("tags", std::move(tags)));
+            items->Append(std::move(item));
+        }
+
+        auto document = ogm::Object::Make();
+        document->Insert(ogm::Field::Make("items", std::move(items)));
+        return document;
+    }
+
+    void BenchCodec(const char *contentType, ogm::Object *document)
+    {
+        String encoded;
+        {
+            ogm::OutputSink sink(encoded);
+            ogm::Serializer::Serialize(document, sink, contentType);
+        }
+        std::printf("%s: %zu bytes\n", contentType, encoded.size());
+
+        Run("  serialize (buffer)", encoded.size(), [&]()
+        {
+            String out;
+            ogm::OutputSink sink(out);
+            ogm::Serializer::Serialize(document, sink, contentType);
+        });
+
+        Run("  serialize (stream)", encoded.size(), [&]()
+        {
+            std::ostringstream out;
+            ogm::OutputSink sink(out);
+            ogm::Serializer::Serialize(document, sink, contentType);
+        });
+
+        Run("  deserialize (buffer)", encoded.size(), [&]()
+        {
+            ogm::Serializer::Deserialize(encoded, contentType);
+        });
+
+        Run("  deserialize (stream)", encoded.size(), [&]()
+        {
+            std::istringstream in(encoded);
+            ogm::Serializer::Deserialize(in, contentType);
+        });
+    }
+
+    /**
+     * \brief   Covers the JSON round trip and the copy of a document of the given shape. Throughput is relative
+     *          to the size of its JSON encoding.
+     */
+    void BenchShape(const char *shape, ogm::Object *document)
+    {
+        String encoded = document->Serialize();
+        std::printf("%s: %zu bytes of JSON\n", shape, encoded.size());
+
+        Run("  json serialize", encoded.size(), [&]()
+        {
+            String out;
+            ogm::OutputSink sink(out);
+            ogm::Serializer::Serialize(document, sink, "application/json");
+        });
+
+        Run("  json deserialize", encoded.size(), [&]()
+        {
+            ogm::Serializer::Deserialize(encoded, "application/json");
+        });
+
+        Run("  json deserialize (arena)", encoded.size(), [&]()
+        {
+            ogm::Arena arena;
+            ogm::Arena::Scope scope(arena);
+            ogm::Serializer::Deserialize(encoded, "application/json");
+        });
+
+        Run("  ogm::Copy", encoded.size(), [&]()
+        {
+            ogm::Copy(*document);
+        });
+
+        Run("  ogm::Copy and one edit", encoded.size(), [&]()
+        {
+            auto copy = ogm::Copy(*document);
+            copy->Insert(ogm::Field::Make("edited", ogm::Int::Make(1)));
+        });
+    }
+
+    /**
+     * \brief   Object::Find on hits and misses, and Array::Append into a growing array.
+     */
+    void BenchContainers(std::size_t size)
+    {
+        auto object = MakeFlat(size);
+        std::vector<String> hits;
+        std::vector<String> misses;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            hits.push_back("field" + std::to_string(i));
+            misses.push_back("absent" + std::to_string(i));
+        }
+        std::printf("%zu members\n", size);
+
+        std::size_t found = 0;
+        Run("  Object::Find (hit, all keys)", 0, [&]()
+        {
+            for (const auto &key : hits) found += object->Find(key) != object->GetFields().End();
+        });
+
+        Run("  Object::Find (miss, all keys)", 0, [&]()
+        {
+            for (const auto &key : misses) found += object->Find(key) != object->GetFields().End();
+        });
+
+        Run("  Array::Append (ints)", 0, [&]()
+        {
+            auto array = ogm::Array::Make();
+            for (std::size_t i = 0; i < size; i++) array->Append(ogm::Int::Make(static_cast<ogm::Int::ValueType>(i)));
+        });
+
+        if (found == 0) std::printf("unexpected: no key found\n");
+    }
+
+    /**
+     * \brief   Compares a fixed-shape status reply built as an OGM tree with the same reply through ogm::Mapping.
+     */
+    void BenchStatus(const char *contentType)
+    {
+        Status status{ 86400, 0.75, "gateway-7", true, { 80, 443, 8080 } };
+        String encoded = ogm::SerializeStruct(status, contentType);
+        std::printf("%s status: %zu bytes\n", contentType, encoded.size());
+
+        Run("  serialize (ogm)", encoded.size(), [&]()
+        {
+            auto ports = ogm::Array::Make();
+            for (auto port : status.ports) ports->Append(ogm::Int::Make(port));
+
+            auto object = ogm::Object::Make();
+            object->Insert(ogm::Field::Make("uptime", ogm::Int::Make(status.uptime)));
+            object->Insert(ogm::Field::Make("load", ogm::Real::Make(status.load)));
+            object->Insert(ogm::Field::Make("name", ogm::String::Make(status.name)));
+            object->Insert(ogm::Field::Make("healthy", ogm::String::Make(status.healthy ? "true" : "false")));
+            object->Insert(ogm::Field::Make("ports", std::move(ports)));
+
+            String out;
+            ogm::OutputSink sink(out);
+            ogm::Serializer::Serialize(object.get(), sink, contentType);
+        });
+
+        Run("  serialize (mapping)", encoded.size(), [&]()
+        {
+            String out;
+            ogm::OutputSink sink(out);
+            ogm::SerializeStruct(status, sink, contentType);
+        });
+
+        Run("  deserialize (mapping)", encoded.size(), [&]()
+        {
+            ogm::DeserializeStruct<Status>(encoded, contentType);
+        });
+    }
+}
+
+/**
+ * Usage: rest_bench [section]. Runs only the sections whose name contains the argument, e.g. "shapes".
+ */
+int main(int argc, char **argv)
+{
+    if (argc > 1) filter = argv[1];
+
+    if (Selected("shapes"))
+    {
+        std::printf("--- shapes ---\n");
+        BenchShape("flat (1000 members)", MakeFlat(1000).get());
+        BenchShape("deep (200 levels)", MakeDeep(200).get());
+        BenchShape("numeric (2 x 10000)", MakeNumeric(10000).get());
+        BenchShape("strings (2000 x 200 bytes)", MakeStrings(2000).get());
+    }
+
+    if (Selected("containers"))
+    {
+        std::printf("--- containers ---\n");
+        for (std::size_t size : { 8, 64, 1024 }) BenchContainers(size);
+    }
+
+    if (Selected("codecs"))
+    {
+        for (std::size_t records : { 16, 4096 })
+        {
+            std::printf("--- codecs, %zu records ---\n", records);
+
+            auto document = MakeDocument(records);
+            for (const char *contentType : { "application/json", "application/cbor", "application/msgpack" })
+            {
+                BenchCodec(contentType, document.get());
+            }
+        }
+    }
+
+    if (Selected("status"))
+    {
+        std::printf("--- status struct ---\n");
+        for (const char *contentType : { "application/json", "application/cbor", "application/msgpack" })
+        {
+            BenchStatus(contentType);
+        }
+    }
+
+    return 0;
+}
@@ -31,6 +31,11 @@ namespace rest
         return binding_->Send(request);
     }
 
+    Task<Pointer<Reply>> Client::Send(const Request &request, const ogm::Projection &projection)
+    {
+        return binding_->Send(request, projection);
+    }
+
     Task<Event>
     Client::Subscribe(const Uri &uri, EventPolicy policy, const Function<NotificationHandlerType> &notify,
                       const Function<SubscriptionStateHandlerType > &state)
@@ -122,6 +127,10 @@ namespace rest
 
     /**
      * ara::rest::Reply Constructors
+     *
+     * Payloads this reply builds by parsing its document are allocated from its own arena and freed together
+     * with it. A copied payload shares its contents with the original until either is modified, so copying
+     * allocates a single node and needs no arena.
      */
     Reply::Reply(const Uri &uri, StatusCode status)
             : header_(uri, status)
@@ -141,6 +150,21 @@ namespace rest
 
     }
 
+    Reply::Reply(const Uri &uri, StatusCode status, String &&binary)
+            : header_(uri, status)
+    {
+        if (binary.empty()) return;
+
+        arena_ = std::make_unique<ogm::Arena>();
+        document_ = std::make_unique<ogm::JsonDocument>(std::move(binary));
+    }
+
+    Reply::Reply(const Uri &uri, StatusCode status, Pointer<ogm::Arena> &&arena, Pointer<ogm::Object> &&payload)
+            : header_(uri, status), arena_(std::move(arena)), payload_(std::move(payload))
+    {
+
+    }
+
     /**
      * ara::rest::Reply Member Functions
      */
@@ -151,18 +175,51 @@ namespace rest
 
     ogm::Object const &Reply::GetObject() const
     {
-        return *payload_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        return GetPayload();
+    }
+
+    /**
+     * A payload that did not arrive as JSON is serialized once; the document is kept for later views and for
+     * ReleaseBinary().
+     */
+    ogm::JsonView Reply::GetView() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!document_) document_ = std::make_unique<ogm::JsonDocument>(GetPayload().Serialize());
+
+        return document_->GetRoot();
     }
 
     Pointer<ogm::Object> &Reply::ReleaseObject()
     {
+        std::lock_guard<std::mutex> lock(mutex_);
+        GetPayload();
+
         return payload_;
     }
 
     Pointer<String> Reply::ReleaseBinary()
     {
-        String binary = payload_->Serialize();
-        return std::make_unique<String>(binary);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (document_) return std::make_unique<String>(document_->GetBinary());
+
+        return std::make_unique<String>(GetPayload().Serialize());
+    }
+
+    /**
+     * Parses the payload on first access. The caller holds mutex_.
+     */
+    const ogm::Object &Reply::GetPayload() const
+    {
+        if (!payload_ && document_)
+        {
+            ogm::Arena::Scope scope(*arena_);
+            payload_ = document_->Materialize();
+        }
+        if (!payload_) payload_ = ogm::Object::Make();
+
+        return *payload_;
     }
 
     /**
@@ -36,7 +36,12 @@ namespace rest
 
     Task<Pointer<Reply>> ClientHttpBinder::Send(const Request &request)
     {
-        return std::async(std::launch::async, &ClientHttpBinder::DoSend, this, std::ref(request));
+        return std::async(std::launch::async, &ClientHttpBinder::DoSend, this, std::ref(request), nullptr);
+    }
+
+    Task<Pointer<Reply>> ClientHttpBinder::Send(const Request &request, const ogm::Projection &projection)
+    {
+        return std::async(std::launch::async, &ClientHttpBinder::DoSend, this, std::ref(request), &projection);
     }
 
     ErrorCode ClientHttpBinder::GetError() const
@@ -49,14 +54,19 @@ namespace rest
 
     }
 
-    Pointer<Reply> ClientHttpBinder::DoSend(const Request &request)
+    /**
+     * Without a projection, small JSON replies are kept raw for lazy access. With one, every supported reply is
+     * decoded straight away so that the unselected members are never built.
+     */
+    Pointer<Reply> ClientHttpBinder::DoSend(const Request &request, const ogm::Projection *projection)
     {
         HTTPRequest pocoRequest(HTTPRequest::HTTP_1_1);
         ConvertRequest(request, pocoRequest);
 
-        auto body = Copy(request.GetObject())->Serialize();
+        auto body = request.GetObject().Serialize();
 
         pocoRequest.setContentType("application/json");
+        pocoRequest.set("Accept", "application/msgpack, application/cbor, application/json;q=0.9");
         pocoRequest.setContentLength(body.length());
 
         std::ostream& requestPayload = session_->sendRequest(pocoRequest);
@@ -65,11 +75,30 @@ namespace rest
 
         HTTPResponse pocoReply;
         std::istream& replyPayload = session_->receiveResponse(pocoReply);
-        std::stringstream ss;
-        Poco::StreamCopier::copyStream(replyPayload, ss);
 
-        auto replyBody = ogm::Serializer::Deserialize(ss.str());
-        Pointer<Reply> reply = std::make_unique<Reply>(request.GetUri(), pocoReply.getStatus(), replyBody);
+        auto contentType = ogm::SerializerRegistry::GetMediaType(pocoReply.getContentType());
+        auto length = pocoReply.getContentLength();
+        bool lazy = !projection && contentType == "application/json" && length != HTTPResponse::UNKNOWN_CONTENT_LENGTH
+                    && static_cast<std::size_t>(length) <= ogm::JsonDocument::kMaxLazySize;
+        if (!lazy && ogm::SerializerRegistry::GetInstance().IsSupported(contentType)
+            && replyPayload.peek() != std::char_traits<char>::eof())
+        {
+            auto arena = std::make_unique<ogm::Arena>();
+            Pointer<ogm::Object> replyObject;
+            {
+                ogm::Arena::Scope scope(*arena);
+                replyObject = projection ? ogm::Serializer::Deserialize(replyPayload, contentType, *projection)
+                                         : ogm::Serializer::Deserialize(replyPayload, contentType);
+            }
+
+            return std::make_unique<Reply>(request.GetUri(), pocoReply.getStatus(), std::move(arena), std::move(replyObject));
+        }
+
+        String replyBody;
+        if (length > 0) replyBody.reserve(static_cast<std::size_t>(length));
+        Poco::StreamCopier::copyToString(replyPayload, replyBody);
+
+        Pointer<Reply> reply = std::make_unique<Reply>(request.GetUri(), pocoReply.getStatus(), std::move(replyBody));
 
         return reply;
     }
@@ -0,0 +1,266 @@
+#include <ara/rest/ogm/arena.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        /**
+         * Blocks are aligned to and made of pages of this size, so the block a node lives in can be found from
+         * the node's address alone, and nodes need no header.
+         */
+        constexpr std::size_t kPageShift = 12;
+        constexpr std::size_t kPageSize = std::size_t(1) << kPageShift;
+
+        /**
+         * Start of every block. Counts one reference for the region that allocates from the block and one for
+         * each live node in it; the block is freed with the last one.
+         */
+        struct Block
+        {
+            explicit Block(std::size_t size) : size(size) {}
+
+            std::atomic<std::size_t> references{ 1 };
+            std::size_t size;
+        };
+
+        constexpr std::size_t kBlockHeaderSize = (sizeof(Block) + alignof(std::max_align_t) - 1)
+                                                 / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+        /**
+         * Radix map from the page number of an address to the block that owns the page, covering 48-bit
+         * addresses. Inner levels are only ever added, and an entry is set exactly while its block exists, so
+         * lookups take no lock. Blocks at higher addresses are not used.
+         */
+        class PageMap
+        {
+        public:
+            static constexpr std::size_t kLeafBits = 12;
+            static constexpr std::size_t kInnerBits = 12;
+            static constexpr std::size_t kPageBits = kLeafBits + 2 * kInnerBits;
+
+            static bool Covers(const void *memory, std::size_t size) noexcept
+            {
+                return (reinterpret_cast<std::uintptr_t>(memory) + size - 1) >> (kPageShift + kPageBits) == 0;
+            }
+
+            Block *Find(const void *memory) const noexcept
+            {
+                std::uintptr_t page = reinterpret_cast<std::uintptr_t>(memory) >> kPageShift;
+                if (page >> kPageBits) return nullptr;
+
+                Inner *inner = root_[RootIndex(page)].load(std::memory_order_acquire);
+                if (!inner) return nullptr;
+
+                Leaf *leaf = inner->entries[InnerIndex(page)].load(std::memory_order_acquire);
+                if (!leaf) return nullptr;
+
+                return leaf->entries[LeafIndex(page)].load(std::memory_order_acquire);
+            }
+
+            /**
+             * Maps every page of a block to block, or to nullptr before the block is freed.
+             */
+            void Assign(const Block *memory, std::size_t size, Block *block)
+            {
+                std::lock_guard<std::mutex> lock(writer_);
+
+                std::uintptr_t first = reinterpret_cast<std::uintptr_t>(memory) >> kPageShift;
+                for (std::uintptr_t page = first; page < first + size / kPageSize; page++)
+                {
+                    auto &inner = root_[RootIndex(page)];
+                    if (!inner.load(std::memory_order_relaxed)) inner.store(new Inner(), std::memory_order_release);
+
+                    auto &leaf = inner.load(std::memory_order_relaxed)->entries[InnerIndex(page)];
+                    if (!leaf.load(std::memory_order_relaxed)) leaf.store(new Leaf(), std::memory_order_release);
+
+                    leaf.load(std::memory_order_relaxed)->entries[LeafIndex(page)].store(block, std::memory_order_release);
+                }
+            }
+
+        private:
+            struct Leaf
+            {
+                std::atomic<Block*> entries[1 << kLeafBits];
+            };
+
+            struct Inner
+            {
+                std::atomic<Leaf*> entries[1 << kInnerBits];
+            };
+
+            static std::size_t RootIndex(std::uintptr_t page) noexcept
+            {
+                return page >> (kInnerBits + kLeafBits);
+            }
+
+            static std::size_t InnerIndex(std::uintptr_t page) noexcept
+            {
+                return (page >> kLeafBits) & ((1 << kInnerBits) - 1);
+            }
+
+            static std::size_t LeafIndex(std::uintptr_t page) noexcept
+            {
+                return page & ((1 << kLeafBits) - 1);
+            }
+
+            std::atomic<Inner*> root_[1 << kInnerBits] = {};
+            std::mutex writer_;
+        };
+
+        PageMap pages;
+
+        Block *NewBlock(std::size_t size)
+        {
+            size = (size + kPageSize - 1) / kPageSize * kPageSize;
+            void *memory = ::operator new(size, std::align_val_t(kPageSize));
+            if (!PageMap::Covers(memory, size))
+            {
+                ::operator delete(memory, std::align_val_t(kPageSize));
+                return nullptr;
+            }
+
+            auto block = new (memory) Block(size);
+            pages.Assign(block, size, block);
+            return block;
+        }
+
+        void Release(Block *block) noexcept
+        {
+            if (block->references.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+            pages.Assign(block, block->size, nullptr);
+            block->~Block();
+            ::operator delete(static_cast<void*>(block), std::align_val_t(kPageSize));
+        }
+    }
+
+    /**
+     * Hands out node memory from the current block. The region holds a reference to each of its blocks until
+     * it is destroyed; a block then lives on only while nodes in it do.
+     */
+    class Arena::Region
+    {
+    public:
+        explicit Region(std::size_t blockSize) : blockSize_((blockSize + kPageSize - 1) / kPageSize * kPageSize) {}
+
+        ~Region()
+        {
+            for (Block *block : blocks_) Release(block);
+        }
+
+        /**
+         * Returns nullptr if no block could be placed where the page map reaches.
+         */
+        void *Allocate(std::size_t size)
+        {
+            size = (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+            if (static_cast<std::size_t>(end_ - cursor_) < size)
+            {
+                // Nodes larger than a quarter block get a block of their own, so the current one is not wasted.
+                if (size > blockSize_ / 4)
+                {
+                    Block *block = AddBlock(kBlockHeaderSize + size);
+                    if (!block) return nullptr;
+
+                    block->references.fetch_add(1, std::memory_order_relaxed);
+                    return reinterpret_cast<char*>(block) + kBlockHeaderSize;
+                }
+
+                Block *block = AddBlock(blockSize_);
+                if (!block) return nullptr;
+
+                current_ = block;
+                cursor_ = reinterpret_cast<char*>(block) + kBlockHeaderSize;
+                end_ = reinterpret_cast<char*>(block) + block->size;
+            }
+
+            char *memory = cursor_;
+            cursor_ += size;
+            current_->references.fetch_add(1, std::memory_order_relaxed);
+            return memory;
+        }
+
+        std::size_t GetCapacity() const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        Block *AddBlock(std::size_t size)
+        {
+            blocks_.reserve(blocks_.size() + 1);
+
+            Block *block = NewBlock(size);
+            if (!block) return nullptr;
+
+            blocks_.push_back(block);
+            capacity_ += block->size;
+            return block;
+        }
+
+        std::size_t blockSize_;
+        std::size_t capacity_ = 0;
+        std::vector<Block*> blocks_;
+        Block *current_ = nullptr;
+        char *cursor_ = nullptr;
+        char *end_ = nullptr;
+    };
+
+    thread_local Arena::Region *Arena::active_ = nullptr;
+
+    Arena::Arena(std::size_t blockSize) : region_(new Region(blockSize))
+    {
+    }
+
+    Arena::~Arena()
+    {
+        delete region_;
+    }
+
+    Arena::Scope::Scope(Arena &arena) noexcept : previous_(active_)
+    {
+        active_ = arena.region_;
+    }
+
+    Arena::Scope::~Scope()
+    {
+        active_ = static_cast<Region*>(previous_);
+    }
+
+    std::size_t Arena::GetCapacity() const noexcept
+    {
+        return region_->GetCapacity();
+    }
+
+    void *Arena::Allocate(std::size_t size)
+    {
+        if (active_)
+        {
+            if (void *memory = active_->Allocate(size)) return memory;
+        }
+
+        return ::operator new(size);
+    }
+
+    void Arena::Deallocate(void *memory) noexcept
+    {
+        if (!memory) return;
+
+        if (Block *block = pages.Find(memory)) Release(block);
+        else ::operator delete(memory);
+    }
+
+}
+}
+}
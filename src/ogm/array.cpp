@@ -1,5 +1,7 @@
 #include <ara/rest/ogm/array.h>
 
+#include <iterator>
+
 namespace ara
 {
 namespace rest
@@ -9,65 +11,180 @@ namespace ogm
 
     std::size_t Array::GetSize() const noexcept
     {
-        return value_.size();
+        const Storage &storage = storage_.Read();
+        return storage.cells.empty() ? storage.values.size() : storage.cells.size();
     }
 
     bool Array::IsEmpty() const noexcept
     {
-        return value_.empty();
+        const Storage &storage = storage_.Read();
+        return storage.values.empty() && storage.cells.empty();
     }
 
     Value &Array::GetValue(std::size_t index) noexcept
     {
-        return *value_.at(index);
+        return *ExposeValues().at(index);
     }
 
     const Value &Array::GetValue(std::size_t index) const noexcept
     {
-        return *value_.at(index);
+        Unpack();
+        return *storage_.Read().values.at(index);
     }
 
     Array::ValueRange Array::GetValues() noexcept
     {
-        return Array::ValueRange(value_.begin(), value_.end());
+        auto &values = ExposeValues();
+        return Array::ValueRange(values.begin(), values.end());
     }
 
     Array::ConstValueRange Array::GetValues() const noexcept
     {
-        return Array::ConstValueRange(value_.cbegin(), value_.cend());
+        Unpack();
+        const auto &values = storage_.Read().values;
+        return Array::ConstValueRange(values.cbegin(), values.cend());
     }
 
     void Array::Append(Pointer<Value> &&value)
     {
-        value_.push_back(std::move(value));
+        WriteValues().push_back(std::move(value));
+    }
+
+    void Array::AppendInt(Int::ValueType value)
+    {
+        if (!storage_.Read().values.empty())
+        {
+            WriteValues().push_back(Int::Make(value));
+            return;
+        }
+
+        Storage &storage = storage_.Write();
+        Cell cell;
+        cell.integer = value;
+        storage.cells.push_back(cell);
+        storage.reals.push_back(false);
+    }
+
+    void Array::AppendReal(Real::ValueType value)
+    {
+        if (!storage_.Read().values.empty())
+        {
+            WriteValues().push_back(Real::Make(value));
+            return;
+        }
+
+        Storage &storage = storage_.Write();
+        Cell cell;
+        cell.real = value;
+        storage.cells.push_back(cell);
+        storage.reals.push_back(true);
     }
 
+    /**
+     * The members taking an iterator locate it by position, as Object's do.
+     */
     void Array::Insert(Array::Iterator iterator, Pointer<Value> &&value)
     {
-        value_.insert(iterator, std::move(value));
+        auto position = iterator - storage_.Read().values.cbegin();
+        ValueType &values = WriteValues();
+        values.insert(values.begin() + position, std::move(value));
     }
 
     Array::Iterator Array::Remove(Array::Iterator iterator)
     {
-        return value_.erase(iterator);
+        auto position = iterator - storage_.Read().values.cbegin();
+        ValueType &values = ExposeValues();
+        return values.erase(values.begin() + position);
     }
 
     std::pair<Array::Iterator, Pointer<Value>> Array::Release(Array::Iterator iterator)
     {
-        Pointer<Value> oldValue = ogm::Copy(*iterator);
-        return std::make_pair(Remove(iterator), std::move(oldValue));
+        auto position = iterator - storage_.Read().values.cbegin();
+        ValueType &values = ExposeValues();
+
+        Pointer<Value> oldValue = std::move(values[position]);
+        return std::make_pair(values.erase(values.begin() + position), std::move(oldValue));
     }
 
     Pointer<Value> Array::Replace(Array::Iterator iterator, Pointer<Value>&& value)
     {
-        Pointer<Value> oldValue = ogm::Copy(*iterator);
-        value_.insert(value_.erase(iterator), std::move(value));
-        return std::move(oldValue);
+        auto position = iterator - storage_.Read().values.cbegin();
+        ValueType &values = WriteValues();
+
+        Pointer<Value> oldValue = std::move(values[position]);
+        values[position] = std::move(value);
+        return oldValue;
     }
 
     void Array::Clear()
     {
-        value_.clear();
+        storage_.Reset();
+    }
+
+    void Array::Unpack() const
+    {
+        const Storage &storage = storage_.Read();
+        if (storage.cells.empty()) return;
+
+        std::call_once(storage.unpacked, [&storage]
+        {
+            ValueType values;
+            values.reserve(storage.cells.size());
+            for (std::size_t i = 0; i < storage.cells.size(); i++)
+            {
+                if (storage.reals[i])   values.push_back(Real::Make(storage.cells[i].real));
+                else                    values.push_back(Int::Make(storage.cells[i].integer));
+            }
+
+            storage.values = std::move(values);
+        });
+    }
+
+    /**
+     * An unpacked array is given a Storage of its own rather than having its cells cleared, since the once_flag
+     * of the packed one cannot be reset.
+     */
+    Array::ValueType &Array::WriteValues()
+    {
+        Storage &storage = storage_.Write();
+        if (storage.cells.empty()) return storage.values;
+
+        Unpack();
+        auto unpacked = std::make_shared<Storage>();
+        unpacked->values = std::move(storage.values);
+        storage_.Reset(std::move(unpacked));
+
+        return storage_.Write().values;
+    }
+
+    Array::ValueType &Array::ExposeValues()
+    {
+        WriteValues();
+        return storage_.Expose().values;
+    }
+
+    void Array::Splice(Array &&tail)
+    {
+        if (IsEmpty())
+        {
+            storage_ = std::move(tail.storage_);
+        }
+        else if (IsPacked() && tail.IsPacked())
+        {
+            Storage &storage = storage_.Write();
+            const Storage &other = tail.storage_.Read();
+            storage.cells.insert(storage.cells.end(), other.cells.begin(), other.cells.end());
+            storage.reals.insert(storage.reals.end(), other.reals.begin(), other.reals.end());
+        }
+        else
+        {
+            ValueType &values = WriteValues();
+            ValueType &other = tail.WriteValues();
+            values.reserve(values.size() + other.size());
+            std::move(other.begin(), other.end(), std::back_inserter(values));
+        }
+
+        tail.Clear();
     }
 
 }
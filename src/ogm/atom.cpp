@@ -0,0 +1,75 @@
+#include <ara/rest/ogm/atom.h>
+
+#include <atomic>
+#include <mutex>
+
+#include <ara/rest/ogm/hash.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+    namespace
+    {
+        /**
+         * Linear-probing table at most half full, so that every probe sequence reaches an empty slot. Slots
+         * are only ever filled, and are published with release order; readers need no lock.
+         */
+        constexpr std::size_t kSlots = Atom::kCapacity * 2;
+
+        std::atomic<const Atom*> slots[kSlots];
+        std::size_t count = 0;
+        std::mutex writer;
+    }
+
+    Atom::Atom(std::uint64_t hash, StringView name) : hash_(hash), name_(name)
+    {
+    }
+
+    const Atom *Atom::Intern(StringView name)
+    {
+        if (name.size() > kMaxLength) return nullptr;
+
+        std::uint64_t hash = Hash(name, 0);
+        if (const Atom *atom = Find(name, hash)) return atom;
+
+        std::lock_guard<std::mutex> lock(writer);
+
+        std::size_t slot = hash & (kSlots - 1);
+        for (const Atom *atom; (atom = slots[slot].load(std::memory_order_acquire)); slot = (slot + 1) & (kSlots - 1))
+        {
+            if (atom->hash_ == hash && atom->GetName() == name) return atom;
+        }
+
+        if (count == kCapacity) return nullptr;
+
+        auto atom = new Atom(hash, name);
+        slots[slot].store(atom, std::memory_order_release);
+        count++;
+
+        return atom;
+    }
+
+    const Atom *Atom::Find(StringView name) noexcept
+    {
+        if (name.size() > kMaxLength) return nullptr;
+
+        return Find(name, Hash(name, 0));
+    }
+
+    const Atom *Atom::Find(StringView name, std::uint64_t hash) noexcept
+    {
+        std::size_t slot = hash & (kSlots - 1);
+        for (const Atom *atom; (atom = slots[slot].load(std::memory_order_acquire)); slot = (slot + 1) & (kSlots - 1))
+        {
+            if (atom->hash_ == hash && atom->GetName() == name) return atom;
+        }
+
+        return nullptr;
+    }
+
+}
+}
+}
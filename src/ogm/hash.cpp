@@ -0,0 +1,211 @@
+#include <ara/rest/ogm/hash.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <vector>
+
+#include <ara/rest/ogm/int.h>
+#include <ara/rest/ogm/real.h>
+#include <ara/rest/ogm/string.h>
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/field.h>
+#include <ara/rest/ogm/projection.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        constexpr std::uint64_t kOffsetBasis = 0xcbf29ce484222325ULL;
+        constexpr std::uint64_t kPrime = 0x100000001b3ULL;
+
+        /**
+         * Type tags keep values of different kinds apart, e.g. the Int 1 and the String "1".
+         */
+        enum Tag : std::uint8_t
+        {
+            kIntTag = 1,
+            kRealTag,
+            kNullTag,
+            kStringTag,
+            kArrayTag,
+            kObjectTag
+        };
+
+        /**
+         * FNV-1a over the bytes, finished with a 64-bit mixer so that nearby inputs spread over all bits.
+         */
+        class Hasher
+        {
+        public:
+            explicit Hasher(std::uint64_t seed = kOffsetBasis) : state_(seed) {}
+
+            void Add(std::uint8_t byte) noexcept
+            {
+                state_ = (state_ ^ byte) * kPrime;
+            }
+
+            void Add(StringView data) noexcept
+            {
+                for (char c : data) Add(static_cast<std::uint8_t>(c));
+            }
+
+            void Add(std::uint64_t value) noexcept
+            {
+                for (int shift = 0; shift < 64; shift += 8) Add(static_cast<std::uint8_t>(value >> shift));
+            }
+
+            std::uint64_t Finish() const noexcept
+            {
+                return Mix(state_);
+            }
+
+            static std::uint64_t Mix(std::uint64_t value) noexcept
+            {
+                value ^= value >> 30;
+                value *= 0xbf58476d1ce4e5b9ULL;
+                value ^= value >> 27;
+                value *= 0x94d049bb133111ebULL;
+                value ^= value >> 31;
+                return value;
+            }
+
+        private:
+            std::uint64_t state_;
+        };
+
+        void AddValue(Hasher &hasher, const Value &value, const Projection::Node *node);
+
+        void AddReal(Hasher &hasher, long double value) noexcept
+        {
+            if (!std::isfinite(value))
+            {
+                hasher.Add(static_cast<std::uint8_t>(kNullTag));
+                return;
+            }
+
+            char buffer[64];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            hasher.Add(static_cast<std::uint8_t>(kRealTag));
+            hasher.Add(StringView(buffer, static_cast<std::size_t>(result.ptr - buffer)));
+        }
+
+        void AddInt(Hasher &hasher, std::int64_t value) noexcept
+        {
+            hasher.Add(static_cast<std::uint8_t>(kIntTag));
+            hasher.Add(static_cast<std::uint64_t>(value));
+        }
+
+        void AddString(Hasher &hasher, StringView value) noexcept
+        {
+            hasher.Add(static_cast<std::uint8_t>(kStringTag));
+            hasher.Add(static_cast<std::uint64_t>(value.size()));
+            hasher.Add(value);
+        }
+
+        void AddArray(Hasher &hasher, const Array &array, const Projection::Node *node)
+        {
+            std::uint64_t count = 0;
+            std::size_t index = 0;
+
+            hasher.Add(static_cast<std::uint8_t>(kArrayTag));
+            if (array.IsPacked())
+            {
+                for (; index < array.GetSize(); index++)
+                {
+                    if (node && !Projection::Select(*node, index)) continue;
+
+                    if (array.IsRealCell(index))    AddReal(hasher, array.GetCell(index).real);
+                    else                            AddInt(hasher, array.GetCell(index).integer);
+                    count++;
+                }
+
+                hasher.Add(count);
+                return;
+            }
+
+            auto values = array.GetValues();
+            for (auto it = values.Begin(); it != values.End(); ++it, index++)
+            {
+                const Projection::Node *child = node ? Projection::Select(*node, index, **it) : nullptr;
+                if (node && !child) continue;
+
+                AddValue(hasher, **it, child && !child->IsSelected() ? child : nullptr);
+                count++;
+            }
+            hasher.Add(count);
+        }
+
+        /**
+         * Members are hashed in the order SerializeCanonical writes them: a stable sort of their names. Duplicate
+         * names keep their relative order, so objects whose canonical JSON differs also hash differently.
+         */
+        void AddObject(Hasher &hasher, const Object &object, const Projection::Node *node)
+        {
+            std::vector<std::pair<const Field*, const Projection::Node*>> members;
+
+            auto fields = object.GetFields();
+            for (auto it = fields.Begin(); it != fields.End(); ++it)
+            {
+                const Field &field = **it;
+                const Projection::Node *child = node ? Projection::Select(*node, field.GetNameView(), field.GetValue()) : nullptr;
+                if (node && !child) continue;
+
+                members.emplace_back(&field, child && !child->IsSelected() ? child : nullptr);
+            }
+
+            std::stable_sort(members.begin(), members.end(), [](const auto &left, const auto &right)
+            {
+                return left.first->GetNameView() < right.first->GetNameView();
+            });
+
+            hasher.Add(static_cast<std::uint8_t>(kObjectTag));
+            hasher.Add(static_cast<std::uint64_t>(members.size()));
+            for (const auto &member : members)
+            {
+                AddString(hasher, member.first->GetNameView());
+                AddValue(hasher, member.first->GetValue(), member.second);
+            }
+        }
+
+        void AddValue(Hasher &hasher, const Value &value, const Projection::Node *node)
+        {
+            if (value.IsInt())          AddInt(hasher, static_cast<const Int&>(value).GetValue());
+            else if (value.IsReal())    AddReal(hasher, static_cast<const Real&>(value).GetValue());
+            else if (value.IsString())  AddString(hasher, static_cast<const String&>(value).GetView());
+            else if (value.IsArray())   AddArray(hasher, static_cast<const Array&>(value), node);
+            else if (value.IsObject())  AddObject(hasher, static_cast<const Object&>(value), node);
+        }
+    }
+
+    std::uint64_t Hash(const Value &value)
+    {
+        Hasher hasher;
+        AddValue(hasher, value, nullptr);
+        return hasher.Finish();
+    }
+
+    std::uint64_t Hash(const Object &object, const Projection &projection)
+    {
+        Hasher hasher;
+        const Projection::Node &root = projection.GetRoot();
+        AddObject(hasher, object, root.IsSelected() ? nullptr : &root);
+        return hasher.Finish();
+    }
+
+    std::uint64_t Hash(StringView data, std::uint64_t seed) noexcept
+    {
+        Hasher hasher(seed ^ kOffsetBasis);
+        hasher.Add(data);
+        return hasher.Finish();
+    }
+
+}
+}
+}
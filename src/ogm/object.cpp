@@ -9,67 +9,135 @@ namespace ogm
 
     std::size_t Object::GetSize() const noexcept
     {
-        return value_.size();
+        return storage_.Read().fields.size();
     }
 
     bool Object::IsEmpty() const noexcept
     {
-        return value_.empty();
+        return storage_.Read().fields.empty();
     }
 
     Object::FieldRange Object::GetFields() noexcept
     {
-        return Object::FieldRange(value_.begin(), value_.end());
+        auto &fields = storage_.Expose().fields;
+        return Object::FieldRange(fields.begin(), fields.end());
     }
 
     Object::ConstFieldRange Object::GetFields() const noexcept
     {
-        return Object::ConstFieldRange(value_.cbegin(), value_.cend());
+        const auto &fields = storage_.Read().fields;
+        return Object::ConstFieldRange(fields.cbegin(), fields.cend());
     }
 
     bool ogm::Object::HasField(std::string_view name) const noexcept
     {
-        return std::any_of(value_.begin(), value_.end(), [&name](const Pointer<Field> &value) { return value->GetName() == name; });
+        return Find(name) != storage_.Read().fields.cend();
     }
 
-    Object::ValueType::iterator ogm::Object::Find(std::string_view name) noexcept
+    /**
+     * The lookup reads the fields in place. Only a found field is exposed, as the iterator gives mutable access
+     * to it; a miss just takes the fields over from other holders, so that its end() matches GetFields().
+     */
+    Object::ValueType::iterator ogm::Object::Find(std::string_view name)
     {
-        return std::find_if(value_.begin(), value_.end(), [&name](const Pointer<Field> &value) { return value->GetName() == name; });
+        const ValueType &shared = storage_.Read().fields;
+        auto position = static_cast<const Object*>(this)->Find(name) - shared.cbegin();
+        bool found = position != static_cast<std::ptrdiff_t>(shared.size());
+
+        ValueType &fields = found ? storage_.Expose().fields : storage_.Write().fields;
+        return fields.begin() + position;
     }
 
     Object::ValueType::const_iterator ogm::Object::Find(std::string_view name) const noexcept
     {
-        return std::find_if(value_.cbegin(), value_.cend(), [&name](const Pointer<Field> &value) { return value->GetName() == name; });;
+        const Storage &storage = storage_.Read();
+        const ValueType &fields = storage.fields;
+
+        if (!storage.index.IsActive())
+        {
+            /**
+             * Interned names are compared by address, names without an atom by content. A parsed name may lack
+             * the atom that exists for it; if name has no atom, no field holding it has one either.
+             */
+            const Atom *atom = Atom::Find(name);
+            return std::find_if(fields.cbegin(), fields.cend(), [&name, atom](const Pointer<Field> &value)
+            {
+                const Atom *other = value->GetAtom();
+                return other ? other == atom : value->GetNameView() == name;
+            });
+        }
+
+        std::size_t position = storage.index.Find(name, [&fields](std::size_t at) { return fields[at]->GetNameView(); });
+        return position == NameIndex::npos ? fields.cend() : fields.cbegin() + position;
     }
 
     bool ogm::Object::Insert(Pointer<Field> &&field)
     {
-        value_.push_back(std::move(field));
+        Storage &storage = storage_.Write();
+        ValueType &fields = storage.fields;
+        fields.push_back(std::move(field));
+
+        if (storage.index.IsActive())
+        {
+            storage.index.Insert(fields.back()->GetNameView(), fields.size() - 1, [&fields](std::size_t at) { return fields[at]->GetNameView(); });
+        }
+        else if (fields.size() >= NameIndex::kThreshold)
+        {
+            Reindex(storage);
+        }
 
         return true;
     }
 
+    /**
+     * The members taking an iterator locate it by position, so that it stays valid if the object was copied
+     * after the iterator was obtained and Write() has to copy the fields.
+     */
     Object::Iterator Object::Remove(Object::Iterator iterator)
     {
-        return value_.erase(iterator);
+        auto position = iterator - storage_.Read().fields.cbegin();
+        Storage &storage = storage_.Expose();
+
+        storage.fields.erase(storage.fields.begin() + position);
+        if (storage.index.IsActive()) Reindex(storage);
+
+        return storage.fields.begin() + position;
     }
 
     std::pair<Object::Iterator, Pointer<Field>> Object::Release(Object::Iterator iterator)
     {
-        Pointer<Field> oldValue = ogm::Copy(*iterator);
-        return std::make_pair(Remove(iterator), std::move(oldValue));
+        auto position = iterator - storage_.Read().fields.cbegin();
+        ValueType &fields = storage_.Expose().fields;
+
+        Pointer<Field> oldValue = std::move(fields[position]);
+        return std::make_pair(Remove(fields.begin() + position), std::move(oldValue));
     }
 
     Pointer<Field> Object::Replace(ValueType::iterator iterator, Pointer<Field> &&field)
     {
-        Pointer<Field> oldValue = ogm::Copy(*iterator);
-        value_.insert(value_.erase(iterator), std::move(field));
-        return std::move(oldValue);
+        auto position = iterator - storage_.Read().fields.cbegin();
+        Storage &storage = storage_.Write();
+
+        Pointer<Field> oldValue = std::move(storage.fields[position]);
+        storage.fields[position] = std::move(field);
+        if (storage.index.IsActive()) Reindex(storage);
+
+        return oldValue;
     }
 
     void ogm::Object::Clear()
     {
-        value_.clear();
+        storage_.Reset();
+    }
+
+    /**
+     * Removing or replacing a field shifts or renames indexed positions, so the index is rebuilt; this costs
+     * no more than the erase it follows.
+     */
+    void Object::Reindex(Storage &storage)
+    {
+        const ValueType &fields = storage.fields;
+        storage.index.Rebuild(fields.size(), [&fields](std::size_t at) { return fields[at]->GetNameView(); });
     }
 }
 }
@@ -0,0 +1,232 @@
+#include <ara/rest/ogm/projection.h>
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/field.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * ara::rest::ogm::Projection::Node Member Functions
+     */
+    const Projection::Node *Projection::Node::Find(StringView name) const noexcept
+    {
+        for (const auto &child : children_)
+        {
+            if (child.name_ == name) return &child;
+        }
+
+        return nullptr;
+    }
+
+    const Projection::Node *Projection::Node::FindElement(std::size_t index) const noexcept
+    {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), index);
+
+        const Node *child = Find(StringView(digits, static_cast<std::size_t>(result.ptr - digits)));
+        if (child) return child;
+
+        return named_ ? this : nullptr;
+    }
+
+    Projection::Node &Projection::Node::Insert(ara::rest::String &&name)
+    {
+        for (auto &child : children_)
+        {
+            if (child.name_ == name) return child;
+        }
+
+        if (name.empty() || name.find_first_not_of("0123456789") != ara::rest::String::npos) named_ = true;
+
+        children_.emplace_back();
+        children_.back().name_ = std::move(name);
+
+        return children_.back();
+    }
+
+    /**
+     * ara::rest::ogm::Projection Member Functions
+     */
+    Projection::Projection(std::initializer_list<StringView> pointers)
+    {
+        for (auto pointer : pointers) Add(pointer);
+    }
+
+    void Projection::Add(StringView pointer)
+    {
+        if (!pointer.empty() && pointer.front() != '/') throw std::invalid_argument("projection: JSON pointer must start with '/'");
+
+        Node *node = &root_;
+        while (!pointer.empty())
+        {
+            pointer.remove_prefix(1);
+            StringView token = pointer.substr(0, pointer.find('/'));
+            pointer.remove_prefix(token.size());
+
+            ara::rest::String name;
+            name.reserve(token.size());
+            for (std::size_t i = 0; i < token.size(); i++)
+            {
+                if (token[i] != '~')
+                {
+                    name += token[i];
+                    continue;
+                }
+
+                char escaped = i + 1 < token.size() ? token[++i] : '\0';
+                if (escaped == '0')         name += '~';
+                else if (escaped == '1')    name += '/';
+                else throw std::invalid_argument("projection: invalid '~' escape in JSON pointer");
+            }
+
+            node = &node->Insert(std::move(name));
+        }
+
+        node->selected_ = true;
+    }
+
+    Projection Projection::FromFieldList(StringView fields)
+    {
+        Projection projection;
+        while (!fields.empty())
+        {
+            StringView path = fields.substr(0, fields.find(','));
+            fields.remove_prefix(std::min(path.size() + 1, fields.size()));
+
+            Node *node = &projection.root_;
+            while (true)
+            {
+                StringView segment = path.substr(0, path.find('.'));
+                if (segment.empty()) throw std::invalid_argument("projection: empty segment in field list");
+
+                node = &node->Insert(ara::rest::String(segment));
+                if (segment.size() == path.size()) break;
+                path.remove_prefix(segment.size() + 1);
+            }
+
+            node->selected_ = true;
+        }
+
+        return projection;
+    }
+
+    void Projection::Apply(Object &object) const
+    {
+        if (!root_.selected_) Apply(object, root_);
+    }
+
+    const Projection::Node *Projection::Select(const Node &node, StringView name, const Value &value) noexcept
+    {
+        const Node *child = node.Find(name);
+        if (!child || (!child->selected_ && !value.IsObject() && !value.IsArray())) return nullptr;
+
+        return child;
+    }
+
+    const Projection::Node *Projection::Select(const Node &node, std::size_t index, const Value &value) noexcept
+    {
+        const Node *child = node.FindElement(index);
+        if (!child || (!child->selected_ && !value.IsObject() && !value.IsArray())) return nullptr;
+
+        return child;
+    }
+
+    const Projection::Node *Projection::Select(const Node &node, std::size_t index) noexcept
+    {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), index);
+
+        const Node *child = node.Find(StringView(digits, static_cast<std::size_t>(result.ptr - digits)));
+        return child && child->selected_ ? child : nullptr;
+    }
+
+    std::size_t Projection::Count(const Object &object, const Node &node) noexcept
+    {
+        if (node.selected_) return object.GetSize();
+
+        auto fields = object.GetFields();
+        return static_cast<std::size_t>(std::count_if(fields.Begin(), fields.End(), [&node](const Pointer<Field> &field)
+        {
+            return Select(node, field->GetNameView(), field->GetValue()) != nullptr;
+        }));
+    }
+
+    std::size_t Projection::Count(const Array &array, const Node &node) noexcept
+    {
+        if (node.selected_) return array.GetSize();
+
+        if (array.IsPacked())
+        {
+            std::size_t selected = 0;
+            for (std::size_t index = 0; index < array.GetSize(); index++)
+            {
+                if (Select(node, index)) selected++;
+            }
+
+            return selected;
+        }
+
+        std::size_t count = 0;
+        std::size_t index = 0;
+        auto values = array.GetValues();
+        std::for_each(values.Begin(), values.End(), [&node, &count, &index](const Pointer<Value> &value)
+        {
+            if (Select(node, index++, *value)) count++;
+        });
+
+        return count;
+    }
+
+    void Projection::Apply(Object &object, const Node &node)
+    {
+        for (auto it = object.GetFields().Begin(); it != object.GetFields().End();)
+        {
+            Value &value = (*it)->GetValue();
+            const Node *child = Select(node, (*it)->GetNameView(), value);
+
+            if (!child)
+            {
+                it = object.Remove(it);
+                continue;
+            }
+
+            if (!child->selected_ && value.IsObject())     Apply(static_cast<Object&>(value), *child);
+            else if (!child->selected_ && value.IsArray())  Apply(static_cast<Array&>(value), *child);
+            ++it;
+        }
+    }
+
+    void Projection::Apply(Array &array, const Node &node)
+    {
+        std::size_t index = 0;
+
+        for (auto it = array.GetValues().Begin(); it != array.GetValues().End(); index++)
+        {
+            Value &value = **it;
+            const Node *child = Select(node, index, value);
+
+            if (!child)
+            {
+                it = array.Remove(it);
+                continue;
+            }
+
+            if (!child->selected_ && value.IsObject())     Apply(static_cast<Object&>(value), *child);
+            else if (!child->selected_ && value.IsArray())  Apply(static_cast<Array&>(value), *child);
+            ++it;
+        }
+    }
+
+}
+}
+}
@@ -0,0 +1,648 @@
+#include <ara/rest/ogm/serializer/cbor_serializer.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <ara/rest/ogm/value.h>
+#include <ara/rest/ogm/int.h>
+#include <ara/rest/ogm/real.h>
+#include <ara/rest/ogm/string.h>
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/field.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        constexpr std::uint8_t kUnsigned   = 0;
+        constexpr std::uint8_t kNegative   = 1;
+        constexpr std::uint8_t kBytes      = 2;
+        constexpr std::uint8_t kText       = 3;
+        constexpr std::uint8_t kArray      = 4;
+        constexpr std::uint8_t kMap        = 5;
+        constexpr std::uint8_t kTag        = 6;
+        constexpr std::uint8_t kSimple     = 7;
+
+        constexpr std::uint8_t kIndefinite = 31;
+        constexpr char kBreak = static_cast<char>(0xFF);
+
+        long double DecodeHalf(std::uint16_t half)
+        {
+            int exponent = (half >> 10) & 0x1F;
+            int mantissa = half & 0x3FF;
+
+            long double value;
+            if (exponent == 0)       value = std::ldexp(static_cast<long double>(mantissa), -24);
+            else if (exponent != 31) value = std::ldexp(static_cast<long double>(mantissa + 1024), exponent - 25);
+            else                     value = mantissa == 0 ? std::numeric_limits<long double>::infinity()
+                                                           : std::numeric_limits<long double>::quiet_NaN();
+
+            return (half & 0x8000) ? -value : value;
+        }
+
+        long double DecodeFloat(std::uint8_t info, std::uint64_t argument)
+        {
+            if (info == 25) return DecodeHalf(static_cast<std::uint16_t>(argument));
+            if (info == 26)
+            {
+                auto bits = static_cast<std::uint32_t>(argument);
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            double value;
+            std::memcpy(&value, &argument, sizeof(value));
+            return value;
+        }
+    }
+
+    void CborSerializer::Serialize(ogm::Value &node, OutputSink &sink)
+    {
+        if (node.IsInt())          Serialize(static_cast<Int&>(node), sink);
+        else if (node.IsReal())    Serialize(static_cast<Real&>(node), sink);
+        else if (node.IsString())  Serialize(static_cast<String&>(node), sink);
+        else if (node.IsArray())   Serialize(static_cast<Array&>(node), sink);
+        else if (node.IsObject())  Serialize(static_cast<Object&>(node), sink);
+    }
+
+    void CborSerializer::Serialize(ogm::Int &node, OutputSink &sink)
+    {
+        WriteInt(node.GetValue(), sink);
+    }
+
+    void CborSerializer::Serialize(ogm::Real &node, OutputSink &sink)
+    {
+        WriteReal(node.GetValue(), sink);
+    }
+
+    void CborSerializer::Serialize(ogm::String &node, OutputSink &sink)
+    {
+        WriteText(node.GetView(), sink);
+    }
+
+    void CborSerializer::Serialize(ogm::Array &node, OutputSink &sink)
+    {
+        WriteHead(kArray, node.GetSize(), sink);
+
+        if (node.IsPacked())
+        {
+            SerializeChildren(node, node.GetSize(), sink, [&node](std::size_t index, OutputSink &out)
+            {
+                WriteCell(node, index, out);
+            });
+            return;
+        }
+
+        auto values = static_cast<const ogm::Array&>(node).GetValues().Begin();
+        SerializeChildren(node, node.GetSize(), sink, [this, values](std::size_t index, OutputSink &out)
+        {
+            Serialize(*values[index], out);
+        });
+    }
+
+    void CborSerializer::Serialize(ogm::Object &node, OutputSink &sink)
+    {
+        WriteHead(kMap, node.GetSize(), sink);
+
+        auto fields = static_cast<const ogm::Object&>(node).GetFields().Begin();
+        SerializeChildren(node, node.GetSize(), sink, [this, fields](std::size_t index, OutputSink &out)
+        {
+            Serialize(*fields[index], out);
+        });
+    }
+
+    void CborSerializer::Serialize(ogm::Field &node, OutputSink &sink)
+    {
+        WriteText(node.GetNameView(), sink);
+        Serialize(node.GetValue(), sink);
+    }
+
+    void CborSerializer::Serialize(ogm::Value &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (node.IsArray())         Serialize(static_cast<Array&>(node), projection, sink);
+        else if (node.IsObject())   Serialize(static_cast<Object&>(node), projection, sink);
+        else                        Serialize(node, sink);
+    }
+
+    void CborSerializer::Serialize(ogm::Array &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (projection.IsSelected())
+        {
+            Serialize(node, sink);
+            return;
+        }
+
+        WriteHead(kArray, Projection::Count(node, projection), sink);
+
+        if (node.IsPacked())
+        {
+            for (std::size_t index = 0; index < node.GetSize(); index++)
+            {
+                if (Projection::Select(projection, index)) WriteCell(node, index, sink);
+            }
+            return;
+        }
+
+        std::size_t index = 0;
+        auto valueIterator = static_cast<const ogm::Array&>(node).GetValues();
+        std::for_each(valueIterator.Begin(), valueIterator.End(), [this, &projection, &sink, &index](const Pointer<ogm::Value> &value)
+        {
+            const Projection::Node *child = Projection::Select(projection, index++, *value);
+            if (child) Serialize(*value, *child, sink);
+        });
+    }
+
+    void CborSerializer::Serialize(ogm::Object &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (projection.IsSelected())
+        {
+            Serialize(node, sink);
+            return;
+        }
+
+        WriteHead(kMap, Projection::Count(node, projection), sink);
+
+        auto fieldIterator = static_cast<const ogm::Object&>(node).GetFields();
+        std::for_each(fieldIterator.Begin(), fieldIterator.End(), [this, &projection, &sink](const Pointer<ogm::Field> &field)
+        {
+            const Projection::Node *child = Projection::Select(projection, field->GetNameView(), field->GetValue());
+            if (!child) return;
+
+            WriteText(field->GetNameView(), sink);
+            Serialize(field->GetValue(), *child, sink);
+        });
+    }
+
+    void CborSerializer::WriteCell(const Array &array, std::size_t index, OutputSink &sink)
+    {
+        if (array.IsRealCell(index))    WriteReal(array.GetCell(index).real, sink);
+        else                            WriteInt(array.GetCell(index).integer, sink);
+    }
+
+    void CborSerializer::WriteHead(std::uint8_t major, std::uint64_t argument, OutputSink &sink)
+    {
+        char buffer[9];
+        std::size_t length;
+
+        if (argument < 24)
+        {
+            buffer[0] = static_cast<char>((major << 5) | argument);
+            length = 0;
+        }
+        else if (argument <= 0xFF)
+        {
+            buffer[0] = static_cast<char>((major << 5) | 24);
+            length = 1;
+        }
+        else if (argument <= 0xFFFF)
+        {
+            buffer[0] = static_cast<char>((major << 5) | 25);
+            length = 2;
+        }
+        else if (argument <= 0xFFFFFFFF)
+        {
+            buffer[0] = static_cast<char>((major << 5) | 26);
+            length = 4;
+        }
+        else
+        {
+            buffer[0] = static_cast<char>((major << 5) | 27);
+            length = 8;
+        }
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            buffer[1 + i] = static_cast<char>(argument >> (8 * (length - 1 - i)));
+        }
+        sink.Append(buffer, 1 + length);
+    }
+
+    void CborSerializer::WriteInt(std::int64_t value, OutputSink &sink)
+    {
+        if (value >= 0) WriteHead(kUnsigned, static_cast<std::uint64_t>(value), sink);
+        else WriteHead(kNegative, static_cast<std::uint64_t>(-(value + 1)), sink);
+    }
+
+    void CborSerializer::WriteReal(long double real, OutputSink &sink)
+    {
+        auto value = static_cast<double>(real);
+        auto narrow = static_cast<float>(value);
+
+        char buffer[9];
+        if (static_cast<double>(narrow) == value || std::isnan(value))
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &narrow, sizeof(bits));
+
+            buffer[0] = static_cast<char>((kSimple << 5) | 26);
+            for (int i = 0; i < 4; i++) buffer[1 + i] = static_cast<char>(bits >> (24 - 8 * i));
+            sink.Append(buffer, 5);
+        }
+        else
+        {
+            std::uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            buffer[0] = static_cast<char>((kSimple << 5) | 27);
+            for (int i = 0; i < 8; i++) buffer[1 + i] = static_cast<char>(bits >> (56 - 8 * i));
+            sink.Append(buffer, 9);
+        }
+    }
+
+    void CborSerializer::WriteText(StringView text, OutputSink &sink)
+    {
+        WriteHead(kText, text.size(), sink);
+        sink.Append(text);
+    }
+
+    Pointer<Value> CborSerializer::DeserializeToValue(const ara::rest::String &binary)
+    {
+        StringView cursor(binary);
+        return ParseValue(cursor, nullptr, 0);
+    }
+
+    Pointer<Int> CborSerializer::DeserializeToInt(const ara::rest::String &binary)
+    {
+        auto value = DeserializeToValue(binary);
+        if (!value->IsInt()) throw std::invalid_argument("cbor: expected an integer");
+
+        return Pointer<Int>(static_cast<Int*>(value.release()));
+    }
+
+    Pointer<Real> CborSerializer::DeserializeToReal(const ara::rest::String &binary)
+    {
+        auto value = DeserializeToValue(binary);
+        if (value->IsInt()) return Real::Make(static_cast<Int&>(*value).GetValue());
+        if (!value->IsReal()) throw std::invalid_argument("cbor: expected a number");
+
+        return Pointer<Real>(static_cast<Real*>(value.release()));
+    }
+
+    Pointer<String> CborSerializer::DeserializeToString(const ara::rest::String &binary)
+    {
+        auto value = DeserializeToValue(binary);
+        if (!value->IsString()) throw std::invalid_argument("cbor: expected a string");
+
+        return Pointer<String>(static_cast<String*>(value.release()));
+    }
+
+    Pointer<Array> CborSerializer::DeserializeToArray(const ara::rest::String &binary)
+    {
+        StringView cursor(binary);
+        Head head = ReadHead(cursor);
+        if (head.major != kArray) throw std::invalid_argument("cbor: expected an array");
+
+        return ParseArray(cursor, head, nullptr, 0);
+    }
+
+    Pointer<Object> CborSerializer::DeserializeToObject(const ara::rest::String &binary)
+    {
+        StringView cursor(binary);
+        Head head = ReadHead(cursor);
+        if (head.major != kMap) throw std::invalid_argument("cbor: expected a map");
+
+        return ParseObject(cursor, head, nullptr, 0);
+    }
+
+    Pointer<Object> CborSerializer::DeserializeToObject(const SharedBuffer &binary)
+    {
+        StringView cursor(*binary);
+        Head head = ReadHead(cursor);
+        if (head.major != kMap) throw std::invalid_argument("cbor: expected a map");
+
+        return ParseObject(cursor, head, binary, 0);
+    }
+
+    Pointer<Field> CborSerializer::DeserializeToField(const ara::rest::String &binary)
+    {
+        StringView cursor(binary);
+        return ParseField(cursor, nullptr, 0);
+    }
+
+    CborSerializer::Head CborSerializer::ReadHead(StringView &cursor)
+    {
+        if (cursor.empty()) throw std::invalid_argument("cbor: unexpected end of input");
+
+        auto initial = static_cast<std::uint8_t>(cursor.front());
+        cursor.remove_prefix(1);
+
+        Head head{ static_cast<std::uint8_t>(initial >> 5), static_cast<std::uint8_t>(initial & 0x1F), 0 };
+        if (head.info < 24)
+        {
+            head.argument = head.info;
+        }
+        else if (head.info <= 27)
+        {
+            std::size_t length = std::size_t{1} << (head.info - 24);
+            StringView bytes = ReadBytes(cursor, length);
+            for (char c : bytes) head.argument = (head.argument << 8) | static_cast<std::uint8_t>(c);
+        }
+        else if (head.info != kIndefinite)
+        {
+            throw std::invalid_argument("cbor: reserved additional information");
+        }
+
+        return head;
+    }
+
+    StringView CborSerializer::ReadBytes(StringView &cursor, std::uint64_t size)
+    {
+        if (cursor.size() < size) throw std::invalid_argument("cbor: unexpected end of input");
+
+        StringView bytes = cursor.substr(0, static_cast<std::size_t>(size));
+        cursor.remove_prefix(static_cast<std::size_t>(size));
+
+        return bytes;
+    }
+
+    Pointer<Value> CborSerializer::ParseValue(StringView &cursor, const SharedBuffer &source, std::size_t depth)
+    {
+        Head head = ReadHead(cursor);
+        return ParseValue(cursor, head, source, depth);
+    }
+
+    /**
+     * Tags nest like containers: each one recurses for the value it wraps, so chains of them count against
+     * kMaxDepth as well.
+     */
+    Pointer<Value> CborSerializer::ParseValue(StringView &cursor, const Head &head, const SharedBuffer &source, std::size_t depth)
+    {
+        bool nests = head.major == kArray || head.major == kMap || head.major == kTag;
+        if (nests && depth >= kMaxDepth) throw std::invalid_argument("cbor: containers nested too deeply");
+
+        switch (head.major)
+        {
+            case kUnsigned:
+                if (head.argument > static_cast<std::uint64_t>(std::numeric_limits<Int::ValueType>::max()))
+                {
+                    return Real::Make(static_cast<Real::ValueType>(head.argument));
+                }
+                return Int::Make(static_cast<Int::ValueType>(head.argument));
+            case kNegative:
+                if (head.argument > static_cast<std::uint64_t>(std::numeric_limits<Int::ValueType>::max()))
+                {
+                    return Real::Make(-1.0L - static_cast<Real::ValueType>(head.argument));
+                }
+                return Int::Make(-1 - static_cast<Int::ValueType>(head.argument));
+            case kBytes:
+            case kText:     return ParseString(cursor, head, source);
+            case kArray:    return ParseArray(cursor, head, source, depth);
+            case kMap:      return ParseObject(cursor, head, source, depth);
+            case kTag:      return ParseValue(cursor, source, depth + 1);
+            default:        return ParseSimple(head);
+        }
+    }
+
+    Pointer<String> CborSerializer::ParseString(StringView &cursor, const Head &head, const SharedBuffer &source)
+    {
+        if (head.info != kIndefinite)
+        {
+            StringView bytes = ReadBytes(cursor, head.argument);
+            if (source) return String::Make(source, bytes);
+
+            return String::Make(ara::rest::String(bytes));
+        }
+
+        ara::rest::String value;
+        while (!cursor.empty() && cursor.front() != kBreak)
+        {
+            Head chunk = ReadHead(cursor);
+            if (chunk.major != head.major || chunk.info == kIndefinite) throw std::invalid_argument("cbor: malformed string chunk");
+
+            StringView bytes = ReadBytes(cursor, chunk.argument);
+            value.append(bytes.data(), bytes.size());
+        }
+        ReadBytes(cursor, 1);
+
+        return String::Make(std::move(value));
+    }
+
+    Pointer<Array> CborSerializer::ParseArray(StringView &cursor, const Head &head, const SharedBuffer &source, std::size_t depth)
+    {
+        auto array = Array::Make();
+
+        if (head.info == kIndefinite)
+        {
+            while (!cursor.empty() && cursor.front() != kBreak) ParseElement(cursor, source, *array, depth + 1);
+            ReadBytes(cursor, 1);
+        }
+        else
+        {
+            for (std::uint64_t i = 0; i < head.argument; i++) ParseElement(cursor, source, *array, depth + 1);
+        }
+
+        return array;
+    }
+
+    /**
+     * Integers in the range of an Int and floats are appended as packed cells; anything else as a node.
+     */
+    void CborSerializer::ParseElement(StringView &cursor, const SharedBuffer &source, Array &array, std::size_t depth)
+    {
+        Head head = ReadHead(cursor);
+        bool fits = head.argument <= static_cast<std::uint64_t>(std::numeric_limits<Int::ValueType>::max());
+        bool isFloat = head.major == kSimple && head.info >= 25 && head.info <= 27;
+
+        if (head.major == kUnsigned && fits)        array.AppendInt(static_cast<Int::ValueType>(head.argument));
+        else if (head.major == kNegative && fits)   array.AppendInt(-1 - static_cast<Int::ValueType>(head.argument));
+        else if (isFloat)                           array.AppendReal(DecodeFloat(head.info, head.argument));
+        else                                        array.Append(ParseValue(cursor, head, source, depth));
+    }
+
+    Pointer<Object> CborSerializer::ParseObject(StringView &cursor, const Head &head, const SharedBuffer &source, std::size_t depth)
+    {
+        auto object = Object::Make();
+
+        if (head.info == kIndefinite)
+        {
+            while (!cursor.empty() && cursor.front() != kBreak) object->Insert(ParseField(cursor, source, depth + 1));
+            ReadBytes(cursor, 1);
+        }
+        else
+        {
+            for (std::uint64_t i = 0; i < head.argument; i++) object->Insert(ParseField(cursor, source, depth + 1));
+        }
+
+        return object;
+    }
+
+    Pointer<Field> CborSerializer::ParseField(StringView &cursor, const SharedBuffer &source, std::size_t depth)
+    {
+        Head head = ReadHead(cursor);
+        if (head.major != kText && head.major != kBytes) throw std::invalid_argument("cbor: map keys must be strings");
+
+        if (head.info != kIndefinite && source)
+        {
+            StringView name = ReadBytes(cursor, head.argument);
+            return Field::Make(source, name, ParseValue(cursor, source, depth));
+        }
+
+        auto name = ParseString(cursor, head, nullptr);
+        return Field::Make(SharedBuffer(), name->GetView(), ParseValue(cursor, source, depth));
+    }
+
+    Pointer<Value> CborSerializer::ParseSimple(const Head &head)
+    {
+        switch (head.info)
+        {
+            case 20:    return String::Make("false");
+            case 21:    return String::Make("true");
+            case 22:
+            case 23:    return String::Make("null");
+            case 25:
+            case 26:
+            case 27:    return Real::Make(DecodeFloat(head.info, head.argument));
+            default:
+                throw std::invalid_argument("cbor: unsupported simple value");
+        }
+    }
+
+    void CborStructWriter::WriteInt(std::int64_t value)
+    {
+        CborSerializer::WriteInt(value, sink_);
+    }
+
+    void CborStructWriter::WriteReal(long double value)
+    {
+        CborSerializer::WriteReal(value, sink_);
+    }
+
+    void CborStructWriter::WriteBool(bool value)
+    {
+        sink_.Append(static_cast<char>((kSimple << 5) | (value ? 21 : 20)));
+    }
+
+    void CborStructWriter::WriteString(StringView value)
+    {
+        CborSerializer::WriteText(value, sink_);
+    }
+
+    void CborStructWriter::BeginObject(std::size_t size)
+    {
+        CborSerializer::WriteHead(kMap, size, sink_);
+    }
+
+    void CborStructWriter::WriteKey(StringView name, std::size_t)
+    {
+        CborSerializer::WriteText(name, sink_);
+    }
+
+    void CborStructWriter::BeginArray(std::size_t size)
+    {
+        CborSerializer::WriteHead(kArray, size, sink_);
+    }
+
+    std::int64_t CborStructReader::ReadInt()
+    {
+        auto head = CborSerializer::ReadHead(cursor_);
+        auto limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+
+        if (head.major == kUnsigned && head.argument <= limit) return static_cast<std::int64_t>(head.argument);
+        if (head.major == kNegative && head.argument <= limit) return -1 - static_cast<std::int64_t>(head.argument);
+
+        throw std::invalid_argument("cbor: expected an integer");
+    }
+
+    long double CborStructReader::ReadReal()
+    {
+        auto head = CborSerializer::ReadHead(cursor_);
+
+        if (head.major == kUnsigned) return static_cast<long double>(head.argument);
+        if (head.major == kNegative) return -1.0L - static_cast<long double>(head.argument);
+        if (head.major == kSimple && head.info >= 25 && head.info <= 27) return DecodeFloat(head.info, head.argument);
+
+        throw std::invalid_argument("cbor: expected a number");
+    }
+
+    bool CborStructReader::ReadBool()
+    {
+        auto head = CborSerializer::ReadHead(cursor_);
+        if (head.major == kSimple && (head.info == 20 || head.info == 21)) return head.info == 21;
+
+        throw std::invalid_argument("cbor: expected a boolean");
+    }
+
+    void CborStructReader::ReadString(ara::rest::String &value)
+    {
+        auto head = CborSerializer::ReadHead(cursor_);
+        if (head.major != kText && head.major != kBytes) throw std::invalid_argument("cbor: expected a string");
+
+        ReadText(head, value);
+    }
+
+    std::size_t CborStructReader::BeginObject()
+    {
+        auto head = CborSerializer::ReadHead(cursor_);
+        if (head.major != kMap) throw std::invalid_argument("cbor: expected a map");
+
+        return head.info == kIndefinite ? StringView::npos : static_cast<std::size_t>(head.argument);
+    }
+
+    bool CborStructReader::NextKey(std::size_t size, std::size_t index, StringView &name)
+    {
+        if (!NextElement(size, index)) return false;
+
+        auto head = CborSerializer::ReadHead(cursor_);
+        if (head.major != kText && head.major != kBytes) throw std::invalid_argument("cbor: map keys must be strings");
+
+        if (head.info != kIndefinite)
+        {
+            name = CborSerializer::ReadBytes(cursor_, head.argument);
+            return true;
+        }
+
+        ReadText(head, name_);
+        name = name_;
+        return true;
+    }
+
+    std::size_t CborStructReader::BeginArray()
+    {
+        auto head = CborSerializer::ReadHead(cursor_);
+        if (head.major != kArray) throw std::invalid_argument("cbor: expected an array");
+
+        return head.info == kIndefinite ? StringView::npos : static_cast<std::size_t>(head.argument);
+    }
+
+    bool CborStructReader::NextElement(std::size_t size, std::size_t index)
+    {
+        if (size != StringView::npos) return index < size;
+
+        if (cursor_.empty()) throw std::invalid_argument("cbor: unexpected end of input");
+        if (cursor_.front() != kBreak) return true;
+
+        cursor_.remove_prefix(1);
+        return false;
+    }
+
+    void CborStructReader::Skip()
+    {
+        CborSerializer parser;
+        parser.ParseValue(cursor_, nullptr, 0);
+    }
+
+    void CborStructReader::ReadText(const CborSerializer::Head &head, ara::rest::String &value)
+    {
+        if (head.info != kIndefinite)
+        {
+            StringView bytes = CborSerializer::ReadBytes(cursor_, head.argument);
+            value.assign(bytes.data(), bytes.size());
+            return;
+        }
+
+        CborSerializer parser;
+        value = parser.ParseString(cursor_, head, nullptr)->GetValue();
+    }
+
+}
+}
+}
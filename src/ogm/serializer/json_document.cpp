@@ -0,0 +1,287 @@
+#include <ara/rest/ogm/serializer/json_document.h>
+
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+
+#include <ara/rest/ogm/string.h>
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/serializer/json_serializer.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * ara::rest::ogm::JsonDocument Member Functions
+     */
+    JsonView JsonDocument::GetRoot() const
+    {
+        const auto &index = GetIndex();
+        if (error_) return JsonView();
+
+        return JsonView(this, 0, index[0]);
+    }
+
+    ErrorCode JsonDocument::GetError() const
+    {
+        GetIndex();
+        return error_;
+    }
+
+    Pointer<Object> JsonDocument::Materialize() const
+    {
+        return GetParser().DeserializeToObject(binary_);
+    }
+
+    Pointer<Object> JsonDocument::Materialize(const Projection &projection) const
+    {
+        ErrorCode error;
+        auto object = GetParser().ParseProjectedDocument(*binary_, projection, binary_, error);
+        JsonSerializer::Check(error);
+
+        return object;
+    }
+
+    /**
+     * Never throws: a structural error is kept in error_, and GetRoot() then hands out no view that could use
+     * the index.
+     */
+    const JsonStructuralIndex &JsonDocument::GetIndex() const
+    {
+        std::call_once(indexed_, [this]()
+        {
+            ErrorCode error;
+            auto index = std::make_unique<JsonStructuralIndex>(JsonStructuralIndex::Build(*binary_, error));
+
+            /**
+             * Pairs every opening bracket with its closing one so that a view can step over a subtree in O(1).
+             */
+            std::vector<JsonStructuralIndex::PositionType> closing(error ? 0 : index->GetSize());
+            std::vector<std::size_t> open;
+            for (std::size_t token = 0; token < closing.size() && !error; token++)
+            {
+                char c = (*binary_)[(*index)[token]];
+                if (c == '{' || c == '[')
+                {
+                    open.push_back(token);
+                }
+                else if (c == '}' || c == ']')
+                {
+                    if (open.empty() || (*binary_)[(*index)[open.back()]] != (c == '}' ? '{' : '['))
+                    {
+                        error = ParseError::kMalformedStructure;
+                        break;
+                    }
+                    closing[open.back()] = static_cast<JsonStructuralIndex::PositionType>(token);
+                    open.pop_back();
+                }
+            }
+            if (!error && !open.empty()) error = ParseError::kMalformedStructure;
+            if (!error && (index->GetSize() == 0 || (*binary_)[(*index)[0]] != '{')) error = ParseError::kTypeMismatch;
+
+            error_ = error;
+            if (!error) closing_ = std::move(closing);
+            index_ = std::move(index);
+        });
+
+        return *index_;
+    }
+
+    JsonSerializer &JsonDocument::GetParser()
+    {
+        static JsonSerializer parser;
+        return parser;
+    }
+
+    /**
+     * ara::rest::ogm::JsonView Member Functions
+     */
+    bool JsonView::IsNumber() const noexcept
+    {
+        if (!IsValid()) return false;
+
+        char c = Front();
+        return c == '-' || (c >= '0' && c <= '9');
+    }
+
+    std::size_t JsonView::GetSize() const
+    {
+        std::size_t size = 0;
+        if (!IsObject() && !IsArray()) return size;
+
+        if (IsEmpty()) return size;
+
+        char close = IsObject() ? '}' : ']';
+
+        std::size_t separator = IsObject() ? token_ + 2 : token_;
+        while (true)
+        {
+            size++;
+            separator = Next(MakeValue(separator));
+            if (At(separator) == close) break;
+            if (IsObject()) separator += 2;
+        }
+
+        return size;
+    }
+
+    bool JsonView::HasField(StringView name) const
+    {
+        return Find(name).IsValid();
+    }
+
+    JsonView JsonView::Find(StringView name) const
+    {
+        if (!IsObject() || IsEmpty()) return JsonView();
+
+        std::size_t key = token_ + 1;
+        while (true)
+        {
+            if (At(key) != '"' || At(key + 1) != ':') throw std::invalid_argument("json: malformed object");
+
+            JsonView value = MakeValue(key + 1);
+            if (KeyEquals(key, name)) return value;
+
+            std::size_t separator = Next(value);
+            if (At(separator) != ',') break;
+            key = separator + 1;
+        }
+
+        return JsonView();
+    }
+
+    JsonView JsonView::GetValue(std::size_t index) const
+    {
+        if (!IsArray() || IsEmpty()) return JsonView();
+
+        JsonView value = MakeValue(token_);
+        for (std::size_t i = 0; i < index; i++)
+        {
+            std::size_t separator = Next(value);
+            if (At(separator) != ',') return JsonView();
+            value = MakeValue(separator);
+        }
+
+        return value;
+    }
+
+    Int::ValueType JsonView::GetInt() const
+    {
+        if (!IsNumber()) throw std::invalid_argument("json: not a number");
+
+        StringView cursor = StringView(*document_->binary_).substr(position_);
+        Int::ValueType integer = 0;
+        Real::ValueType real = 0;
+        ErrorCode error;
+        bool isReal = JsonSerializer::ScanNumber(cursor, integer, real, error);
+        JsonSerializer::Check(error);
+        if (!isReal) return integer;
+
+        // The conversion is undefined outside the range of Int, which also covers the infinity of 1e400.
+        constexpr Real::ValueType kLimit = -static_cast<Real::ValueType>(std::numeric_limits<Int::ValueType>::min());
+        if (!(real >= -kLimit && real < kLimit)) JsonSerializer::Check(ParseError::kNumberOutOfRange);
+
+        return static_cast<Int::ValueType>(real);
+    }
+
+    Real::ValueType JsonView::GetReal() const
+    {
+        if (!IsNumber()) throw std::invalid_argument("json: not a number");
+
+        StringView cursor = StringView(*document_->binary_).substr(position_);
+        Int::ValueType integer = 0;
+        Real::ValueType real = 0;
+        ErrorCode error;
+        bool isReal = JsonSerializer::ScanNumber(cursor, integer, real, error);
+        JsonSerializer::Check(error);
+        if (isReal) return real;
+
+        return static_cast<Real::ValueType>(integer);
+    }
+
+    ara::rest::String JsonView::GetString() const
+    {
+        if (!IsString()) throw std::invalid_argument("json: not a string");
+
+        ErrorCode error;
+        StringView cursor = StringView(*document_->binary_).substr(position_);
+        auto value = JsonSerializer::ParseString(cursor, error);
+        JsonSerializer::Check(error);
+
+        return value;
+    }
+
+    Pointer<Value> JsonView::Materialize() const
+    {
+        if (!IsValid()) return Pointer<Value>();
+
+        ErrorCode error;
+        std::size_t token = token_;
+        auto value = JsonDocument::GetParser().ParseIndexedValue(*document_->binary_, document_->GetIndex(), token, position_,
+                                                                 document_->binary_, 0, error);
+        JsonSerializer::Check(error);
+
+        return value;
+    }
+
+    char JsonView::At(std::size_t token) const
+    {
+        const auto &index = document_->GetIndex();
+        if (token >= index.GetSize()) throw std::invalid_argument("json: unexpected end of input");
+
+        return (*document_->binary_)[index[token]];
+    }
+
+    /**
+     * Scalars are not structural, so the token after the opening bracket of "[5]" is already the closing one;
+     * a container is only empty if nothing but whitespace separates the two.
+     */
+    bool JsonView::IsEmpty() const
+    {
+        return MakeValue(token_).Front() == (IsObject() ? '}' : ']');
+    }
+
+    JsonView JsonView::MakeValue(std::size_t separator) const
+    {
+        const auto &binary = *document_->binary_;
+        const auto &index = document_->GetIndex();
+
+        std::size_t position = index[separator] + 1;
+        while (position < binary.size() && std::isspace(static_cast<unsigned char>(binary[position]))) position++;
+        if (position >= binary.size()) throw std::invalid_argument("json: unexpected end of input");
+
+        return JsonView(document_, separator + 1, position);
+    }
+
+    std::size_t JsonView::Next(const JsonView &value) const
+    {
+        switch (value.Front())
+        {
+            case '{':
+            case '[':   return document_->GetClosing(value.token_) + 1;
+            case '"':   return value.token_ + 1;
+            default:    return value.token_;
+        }
+    }
+
+    bool JsonView::KeyEquals(std::size_t token, StringView name) const
+    {
+        StringView raw = StringView(*document_->binary_).substr(document_->GetIndex()[token] + 1);
+        std::size_t end = raw.find_first_of("\\\"");
+        if (end != StringView::npos && raw[end] == '"') return raw.substr(0, end) == name;
+
+        ErrorCode error;
+        StringView cursor = StringView(*document_->binary_).substr(document_->GetIndex()[token]);
+        auto key = JsonSerializer::ParseString(cursor, error);
+        JsonSerializer::Check(error);
+
+        return key == name;
+    }
+
+}
+}
+}
@@ -0,0 +1,396 @@
+#include <ara/rest/ogm/serializer/json_push_parser.h>
+
+#include <cctype>
+
+#include <ara/rest/ogm/value.h>
+#include <ara/rest/ogm/string.h>
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/field.h>
+#include <ara/rest/ogm/serializer/json_serializer.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        bool IsBareTokenChar(char c)
+        {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '+' || c == '.';
+        }
+    }
+
+    bool JsonPushParser::Feed(StringView chunk, ErrorCode &error)
+    {
+        if (inToken_ && !error_)
+        {
+            std::size_t end = FindTokenEnd(chunk, 0);
+            std::size_t taken = end == StringView::npos ? chunk.size() : end;
+            if (!discard_) pending_.append(chunk.data(), taken);
+            chunk.remove_prefix(taken);
+
+            if (end != StringView::npos)
+            {
+                inToken_ = false;
+                if (discard_)
+                {
+                    DiscardToken();
+                }
+                else
+                {
+                    CompleteToken(pending_);
+                    pending_.clear();
+                }
+            }
+        }
+
+        while (!chunk.empty() && !error_) Step(chunk);
+
+        if (error_) error = error_;
+        return !error_;
+    }
+
+    Pointer<Object> JsonPushParser::Finish(ErrorCode &error)
+    {
+        if (!error_ && state_ != State::kDone) error_ = ParseError::kUnexpectedEnd;
+        if (error_)
+        {
+            error = error_;
+            return nullptr;
+        }
+
+        return std::move(root_);
+    }
+
+    /**
+     * Consumes one structural character or one complete token from the front of the cursor. A token that
+     * runs into the end of the cursor is moved to pending_ and finished by the next Feed().
+     */
+    void JsonPushParser::Step(StringView &cursor)
+    {
+        if (state_ == State::kSkip)
+        {
+            Skip(cursor);
+            return;
+        }
+
+        JsonSerializer::SkipWhitespace(cursor);
+        if (cursor.empty()) return;
+
+        char c = cursor.front();
+        switch (state_)
+        {
+            case State::kValueOrClose:
+                if (c == ']')
+                {
+                    cursor.remove_prefix(1);
+                    Close();
+                    return;
+                }
+                StepValue(cursor, c);
+                return;
+
+            case State::kValue:
+                StepValue(cursor, c);
+                return;
+
+            case State::kKeyOrClose:
+                if (c == '}')
+                {
+                    cursor.remove_prefix(1);
+                    Close();
+                    return;
+                }
+                // fall through
+            case State::kKey:
+                if (c == '"') BeginToken(cursor, false);
+                else error_ = ParseError::kUnexpectedToken;
+                return;
+
+            case State::kColon:
+                if (c == ':')
+                {
+                    cursor.remove_prefix(1);
+                    state_ = State::kValue;
+                }
+                else
+                {
+                    error_ = ParseError::kUnexpectedToken;
+                }
+                return;
+
+            case State::kCommaOrClose:
+            {
+                bool isArray = stack_.back().container->IsArray();
+                cursor.remove_prefix(1);
+                if (c == ',') state_ = isArray ? State::kValue : State::kKey;
+                else if (c == (isArray ? ']' : '}')) Close();
+                else error_ = ParseError::kUnexpectedToken;
+                return;
+            }
+
+            case State::kSkip:
+                return;
+
+            case State::kDone:
+                error_ = ParseError::kUnexpectedToken;
+                return;
+        }
+    }
+
+    void JsonPushParser::StepValue(StringView &cursor, char c)
+    {
+        if (stack_.empty() && c != '{')
+        {
+            error_ = ParseError::kUnexpectedToken;
+            return;
+        }
+
+        bool skip = false;
+        const Projection::Node *node = Resolve(skip);
+
+        if (c == '{' || c == '[')
+        {
+            cursor.remove_prefix(1);
+            if (skip)
+            {
+                state_ = State::kSkip;
+                skipDepth_ = 1;
+            }
+            else if (c == '{')
+            {
+                Open(Object::Make(), State::kKeyOrClose, node);
+            }
+            else
+            {
+                Open(Array::Make(), State::kValueOrClose, node);
+            }
+        }
+        else if (c == '"' || IsBareTokenChar(c))
+        {
+            // A path that ends inside a scalar selects nothing, so only fully selected scalars are built.
+            BeginToken(cursor, skip || node);
+        }
+        else
+        {
+            error_ = ParseError::kUnexpectedToken;
+        }
+    }
+
+    /**
+     * Skips an unselected container by bracket depth. Strings inside it are still scanned as tokens so that
+     * brackets within them are not counted.
+     */
+    void JsonPushParser::Skip(StringView &cursor)
+    {
+        std::size_t pos = cursor.find_first_of("\"{}[]");
+        if (pos == StringView::npos)
+        {
+            cursor = StringView();
+            return;
+        }
+
+        char c = cursor[pos];
+        if (c == '"')
+        {
+            cursor.remove_prefix(pos);
+            BeginToken(cursor, true);
+            return;
+        }
+
+        cursor.remove_prefix(pos + 1);
+        if (c == '{' || c == '[') skipDepth_++;
+        else if (--skipDepth_ == 0) AddValue(nullptr);
+    }
+
+    void JsonPushParser::BeginToken(StringView &cursor, bool discard)
+    {
+        inString_ = cursor.front() == '"';
+        escaped_ = false;
+        discard_ = discard;
+
+        std::size_t end = FindTokenEnd(cursor, inString_ ? 1 : 0);
+        if (end == StringView::npos)
+        {
+            if (!discard_) pending_.assign(cursor.data(), cursor.size());
+            inToken_ = true;
+            cursor = StringView();
+            return;
+        }
+
+        StringView token = cursor.substr(0, end);
+        cursor.remove_prefix(end);
+
+        if (discard_) DiscardToken();
+        else CompleteToken(token);
+    }
+
+    /**
+     * Returns the offset just past the current token, or npos if it continues beyond data. For strings the
+     * escape state is carried in escaped_ so that a backslash at the end of one chunk applies to the next.
+     */
+    std::size_t JsonPushParser::FindTokenEnd(StringView data, std::size_t from)
+    {
+        if (!inString_)
+        {
+            while (from < data.size() && IsBareTokenChar(data[from])) from++;
+            return from < data.size() ? from : StringView::npos;
+        }
+
+        while (from < data.size())
+        {
+            if (escaped_)
+            {
+                escaped_ = false;
+                from++;
+                continue;
+            }
+
+            from = data.find_first_of("\\\"", from);
+            if (from == StringView::npos) break;
+            if (data[from] == '"') return from + 1;
+
+            escaped_ = true;
+            from++;
+        }
+
+        return StringView::npos;
+    }
+
+    void JsonPushParser::CompleteToken(StringView token)
+    {
+        StringView cursor(token);
+
+        if (state_ == State::kKey || state_ == State::kKeyOrClose)
+        {
+            stack_.back().key = JsonSerializer::ParseString(cursor, error_);
+            state_ = State::kColon;
+            return;
+        }
+
+        Pointer<Value> value;
+        switch (token.front())
+        {
+            case '"':
+                value = String::Make(JsonSerializer::ParseString(cursor, error_));
+                break;
+            case '-':
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9':
+                if (!stack_.empty() && stack_.back().container->IsArray())
+                {
+                    JsonSerializer::ParseNumber(cursor, static_cast<Array&>(*stack_.back().container), error_);
+                    if (!error_ && !cursor.empty()) error_ = ParseError::kMalformedNumber;
+                    if (!error_) AddValue(nullptr);
+                    return;
+                }
+
+                value = JsonSerializer::ParseNumber(cursor, error_);
+                if (!error_ && !cursor.empty()) error_ = ParseError::kMalformedNumber;
+                break;
+            default:
+                value = JsonSerializer::ParseLiteral(cursor, error_);
+                if (!error_ && !cursor.empty()) error_ = ParseError::kUnexpectedToken;
+                break;
+        }
+
+        if (!error_) AddValue(std::move(value));
+    }
+
+    /**
+     * A discarded token is either a string inside a skipped container or an unselected scalar member.
+     */
+    void JsonPushParser::DiscardToken()
+    {
+        if (state_ != State::kSkip) AddValue(nullptr);
+    }
+
+    /**
+     * Looks up the projection node for the value about to be parsed. Returns nullptr if the whole value is
+     * selected and sets skip if none of it is.
+     */
+    const Projection::Node *JsonPushParser::Resolve(bool &skip) const
+    {
+        skip = false;
+
+        const Projection::Node *node = nullptr;
+        if (stack_.empty())
+        {
+            node = projection_ ? &projection_->GetRoot() : nullptr;
+        }
+        else if (const Projection::Node *parent = stack_.back().node)
+        {
+            const Frame &top = stack_.back();
+            if (top.container->IsArray())
+            {
+                node = parent->FindElement(top.index);
+            }
+            else
+            {
+                node = parent->Find(top.key);
+            }
+
+            if (!node)
+            {
+                skip = true;
+                return nullptr;
+            }
+        }
+
+        return node && !node->IsSelected() ? node : nullptr;
+    }
+
+    void JsonPushParser::Open(Pointer<Value> &&container, State state, const Projection::Node *node)
+    {
+        if (stack_.size() >= Serializer::kMaxDepth)
+        {
+            error_ = ParseError::kNestingTooDeep;
+            return;
+        }
+
+        stack_.push_back(Frame{ std::move(container), node, ara::rest::String(), 0 });
+        state_ = state;
+    }
+
+    void JsonPushParser::Close()
+    {
+        Pointer<Value> container = std::move(stack_.back().container);
+        stack_.pop_back();
+
+        if (!stack_.empty())
+        {
+            AddValue(std::move(container));
+            return;
+        }
+
+        root_ = Pointer<Object>(static_cast<Object*>(container.release()));
+        state_ = State::kDone;
+    }
+
+    /**
+     * Adds a completed member to the innermost container. value is empty for a member that was skipped or
+     * that was already appended to an array as a packed cell.
+     */
+    void JsonPushParser::AddValue(Pointer<Value> &&value)
+    {
+        Frame &top = stack_.back();
+        if (value && top.container->IsArray())
+        {
+            static_cast<Array&>(*top.container).Append(std::move(value));
+        }
+        else if (value)
+        {
+            static_cast<Object&>(*top.container).Insert(Field::Make(SharedBuffer(), top.key, std::move(value)));
+        }
+
+        top.index++;
+        state_ = State::kCommaOrClose;
+    }
+
+}
+}
+}
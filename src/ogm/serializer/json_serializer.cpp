@@ -1,6 +1,16 @@
 #include <ara/rest/ogm/serializer/json_serializer.h>
+#include <ara/rest/ogm/serializer/json_push_parser.h>
+#include <ara/rest/ogm/serializer/worker_pool.h>
 
 #include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <cctype>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include <ara/rest/ogm/value.h>
 #include <ara/rest/ogm/int.h>
@@ -17,246 +27,1623 @@ namespace rest
 {
 namespace ogm
 {
+    namespace
+    {
+        bool IsNumberStart(char c) noexcept
+        {
+            return c == '-' || (c >= '0' && c <= '9');
+        }
+    }
+
+    void JsonSerializer::Serialize(ogm::Value &node, OutputSink &sink)
+    {
+        if (node.IsInt())          Serialize(static_cast<Int&>(node), sink);
+        else if (node.IsReal())    Serialize(static_cast<Real&>(node), sink);
+        else if (node.IsString())  Serialize(static_cast<String&>(node), sink);
+        else if (node.IsArray())   Serialize(static_cast<Array&>(node), sink);
+        else if (node.IsObject())  Serialize(static_cast<Object&>(node), sink);
+    }
+
+    void JsonSerializer::Serialize(ogm::Int &node, OutputSink &sink)
+    {
+        SerializeNumber(node.GetValue(), sink);
+    }
 
-    ara::rest::String JsonSerializer::Serialize(ogm::Value &node)
+    void JsonSerializer::Serialize(ogm::Real &node, OutputSink &sink)
     {
-        ara::rest::String serializedString;
-        if (node.IsInt())          serializedString = Serialize(dynamic_cast<Int&>(node));
-        else if (node.IsReal())    serializedString = Serialize(dynamic_cast<Real&>(node));
-        else if (node.IsString())  serializedString = Serialize(dynamic_cast<String&>(node));
-        else if (node.IsArray())   serializedString = Serialize(dynamic_cast<Array&>(node));
-        else if (node.IsObject())  serializedString = Serialize(dynamic_cast<Object&>(node));
+        SerializeNumber(node.GetValue(), sink);
+    }
 
-        return serializedString;
+    void JsonSerializer::Serialize(ogm::String &node, OutputSink &sink)
+    {
+        SerializeEscaped(node.GetView(), sink);
     }
 
-    ara::rest::String JsonSerializer::Serialize(ogm::Int &node)
+    void JsonSerializer::Serialize(ogm::Array &node, OutputSink &sink)
     {
-        return std::to_string(node.GetValue());
+        sink.Append("[ ");
+
+        if (node.IsPacked())
+        {
+            SerializeChildren(node, node.GetSize(), sink, [&node](std::size_t index, OutputSink &out)
+            {
+                if (index != 0) out.Append(", ");
+                SerializeCell(node, index, out);
+            });
+
+            sink.Append(" ]");
+            return;
+        }
+
+        auto values = static_cast<const ogm::Array&>(node).GetValues().Begin();
+        SerializeChildren(node, node.GetSize(), sink, [this, values](std::size_t index, OutputSink &out)
+        {
+            if (index != 0) out.Append(", ");
+            Serialize(*values[index], out);
+        });
+
+        sink.Append(" ]");
     }
 
-    ara::rest::String JsonSerializer::Serialize(ogm::Real &node)
+    void JsonSerializer::Serialize(ogm::Object &node, OutputSink &sink)
     {
-        return std::to_string(node.GetValue());
+        sink.Append("{ ");
+
+        auto fields = static_cast<const ogm::Object&>(node).GetFields().Begin();
+        SerializeChildren(node, node.GetSize(), sink, [this, fields](std::size_t index, OutputSink &out)
+        {
+            if (index != 0) out.Append(", ");
+            Serialize(*fields[index], out);
+        });
+
+        sink.Append(" }");
     }
 
-    ara::rest::String JsonSerializer::Serialize(ogm::String &node)
+    void JsonSerializer::Serialize(ogm::Field &node, OutputSink &sink)
     {
-        std::ostringstream out;
-        out << "\"" << node.GetValue() << "\"";
+        SerializeEscaped(node.GetNameView(), sink);
+        sink.Append(" : ");
+        Serialize(node.GetValue(), sink);
+    }
 
-        return out.str();
+    void JsonSerializer::Serialize(ogm::Value &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (node.IsArray())         Serialize(static_cast<Array&>(node), projection, sink);
+        else if (node.IsObject())   Serialize(static_cast<Object&>(node), projection, sink);
+        else                        Serialize(node, sink);
     }
 
-    ara::rest::String JsonSerializer::Serialize(ogm::Array &node)
+    void JsonSerializer::Serialize(ogm::Array &node, const Projection::Node &projection, OutputSink &sink)
     {
-        std::ostringstream out;
-        out << "[ ";
+        if (projection.IsSelected())
+        {
+            Serialize(node, sink);
+            return;
+        }
 
-        if (!node.IsEmpty())
+        sink.Append("[ ");
+
+        bool first = true;
+        if (node.IsPacked())
         {
-            auto valueIterator = node.GetValues();
-            std::for_each(valueIterator.Begin(), valueIterator.End(), [this, &out](const Pointer<ogm::Value> &value)
+            for (std::size_t index = 0; index < node.GetSize(); index++)
             {
-                out << Serialize(*value) << ", ";
-            });
-            out.seekp(-2, std::ios_base::cur);
+                if (!Projection::Select(projection, index)) continue;
+
+                if (!first) sink.Append(", ");
+                SerializeCell(node, index, sink);
+                first = false;
+            }
+
+            sink.Append(" ]");
+            return;
+        }
+
+        std::size_t index = 0;
+        auto valueIterator = static_cast<const ogm::Array&>(node).GetValues();
+        std::for_each(valueIterator.Begin(), valueIterator.End(), [this, &projection, &sink, &first, &index](const Pointer<ogm::Value> &value)
+        {
+            const Projection::Node *child = Projection::Select(projection, index++, *value);
+            if (!child) return;
+
+            if (!first) sink.Append(", ");
+            Serialize(*value, *child, sink);
+            first = false;
+        });
+
+        sink.Append(" ]");
+    }
+
+    void JsonSerializer::Serialize(ogm::Object &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (projection.IsSelected())
+        {
+            Serialize(node, sink);
+            return;
         }
-        out << " ]";
 
-        return out.str();
+        sink.Append("{ ");
+
+        bool first = true;
+        auto fieldIterator = static_cast<const ogm::Object&>(node).GetFields();
+        std::for_each(fieldIterator.Begin(), fieldIterator.End(), [this, &projection, &sink, &first](const Pointer<ogm::Field> &field)
+        {
+            const Projection::Node *child = Projection::Select(projection, field->GetNameView(), field->GetValue());
+            if (!child) return;
+
+            if (!first) sink.Append(", ");
+            SerializeEscaped(field->GetNameView(), sink);
+            sink.Append(" : ");
+            Serialize(field->GetValue(), *child, sink);
+            first = false;
+        });
+
+        sink.Append(" }");
+    }
+
+    void JsonSerializer::SerializeCanonical(const Value &value, OutputSink &sink)
+    {
+        SerializeCanonical(value, nullptr, sink);
+    }
+
+    void JsonSerializer::SerializeCanonical(const Object &object, const Projection &projection, OutputSink &sink)
+    {
+        const Projection::Node &root = projection.GetRoot();
+        SerializeCanonical(object, root.IsSelected() ? nullptr : &root, sink);
     }
 
-    ara::rest::String JsonSerializer::Serialize(ogm::Object &node)
+    /**
+     * projection is nullptr when the whole value is selected. Members are written in the order of a
+     * stable sort of their names, so duplicate names keep their relative order.
+     */
+    void JsonSerializer::SerializeCanonical(const Value &value, const Projection::Node *projection, OutputSink &sink)
     {
-        std::ostringstream out;
-        out << "{ ";
+        if (value.IsInt())          SerializeNumber(static_cast<const Int&>(value).GetValue(), sink);
+        else if (value.IsReal())    SerializeNumber(static_cast<const Real&>(value).GetValue(), sink);
+        else if (value.IsString())  SerializeEscaped(static_cast<const String&>(value).GetView(), sink);
+        else if (value.IsArray())
+        {
+            sink.Append('[');
+
+            bool first = true;
+            const auto &array = static_cast<const Array&>(value);
+            if (array.IsPacked())
+            {
+                for (std::size_t index = 0; index < array.GetSize(); index++)
+                {
+                    if (projection && !Projection::Select(*projection, index)) continue;
+
+                    if (!first) sink.Append(',');
+                    SerializeCell(array, index, sink);
+                    first = false;
+                }
+            }
+            else
+            {
+                std::size_t index = 0;
+                auto values = array.GetValues();
+                for (auto it = values.Begin(); it != values.End(); ++it, index++)
+                {
+                    const Projection::Node *child = projection ? Projection::Select(*projection, index, **it) : nullptr;
+                    if (projection && !child) continue;
+
+                    if (!first) sink.Append(',');
+                    SerializeCanonical(**it, child && !child->IsSelected() ? child : nullptr, sink);
+                    first = false;
+                }
+            }
 
-        if (!node.IsEmpty())
+            sink.Append(']');
+        }
+        else if (value.IsObject())
         {
-            auto fieldIterator = node.GetFields();
-            std::for_each(fieldIterator.Begin(), fieldIterator.End(), [this, &out](const Pointer<ogm::Field> &field)
+            const auto &object = static_cast<const Object&>(value);
+            std::vector<const Field*> fields;
+            fields.reserve(object.GetSize());
+
+            auto range = object.GetFields();
+            std::for_each(range.Begin(), range.End(), [&fields](const Pointer<Field> &field) { fields.push_back(field.get()); });
+            std::stable_sort(fields.begin(), fields.end(), [](const Field *left, const Field *right)
             {
-                out << Serialize(*field) << ", ";
+                return left->GetNameView() < right->GetNameView();
             });
-            out.seekp(-2, std::ios_base::cur);
+
+            sink.Append('{');
+
+            bool first = true;
+            for (const Field *field : fields)
+            {
+                const Projection::Node *child = projection ? Projection::Select(*projection, field->GetNameView(), field->GetValue()) : nullptr;
+                if (projection && !child) continue;
+
+                if (!first) sink.Append(',');
+                SerializeEscaped(field->GetNameView(), sink);
+                sink.Append(':');
+                SerializeCanonical(field->GetValue(), child && !child->IsSelected() ? child : nullptr, sink);
+                first = false;
+            }
+
+            sink.Append('}');
+        }
+    }
+
+    void JsonSerializer::SerializeNumber(std::int64_t value, OutputSink &sink)
+    {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        sink.Append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+    }
+
+    /**
+     * Reals are written in the shortest form that reads back to the same value, independent of the
+     * locale. Values a double holds exactly are shortened as doubles, so 0.1 is not written with the
+     * digits only long double precision would need. A marker keeps integral reals from reading back
+     * as Ints; JSON has no representation for infinities and NaN, so they become null.
+     */
+    void JsonSerializer::SerializeNumber(long double value, OutputSink &sink)
+    {
+        if (!std::isfinite(value))
+        {
+            sink.Append("null");
+            return;
         }
-        out << " }";
 
-        return out.str();
+        char buffer[64];
+        auto narrow = static_cast<double>(value);
+        auto result = static_cast<long double>(narrow) == value
+                      ? std::to_chars(buffer, buffer + sizeof(buffer), narrow)
+                      : std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+        StringView text(buffer, static_cast<std::size_t>(result.ptr - buffer));
+        sink.Append(text);
+        if (text.find_first_of(".eE") == StringView::npos) sink.Append(".0");
+    }
+
+    void JsonSerializer::SerializeCell(const Array &array, std::size_t index, OutputSink &sink)
+    {
+        if (array.IsRealCell(index))    SerializeNumber(array.GetCell(index).real, sink);
+        else                            SerializeNumber(array.GetCell(index).integer, sink);
     }
 
-    ara::rest::String JsonSerializer::Serialize(ogm::Field &node)
+    void JsonSerializer::SerializeEscaped(StringView value, OutputSink &sink)
     {
-        std::ostringstream out;
-        out << "\"" << node.GetName() << "\" : " << Serialize(node.GetValue());
+        static const char hex[] = "0123456789abcdef";
+
+        sink.Append('"');
+        while (!value.empty())
+        {
+            std::size_t run = 0;
+            while (run < value.size())
+            {
+                auto c = static_cast<unsigned char>(value[run]);
+                if (c < 0x20 || c == '"' || c == '\\') break;
+                run++;
+            }
+            sink.Append(value.data(), run);
+            value.remove_prefix(run);
+            if (value.empty()) break;
 
-        return out.str();
+            auto c = static_cast<unsigned char>(value.front());
+            value.remove_prefix(1);
+            switch (c)
+            {
+                case '"':   sink.Append("\\\""); break;
+                case '\\':  sink.Append("\\\\"); break;
+                case '\b':  sink.Append("\\b"); break;
+                case '\f':  sink.Append("\\f"); break;
+                case '\n':  sink.Append("\\n"); break;
+                case '\r':  sink.Append("\\r"); break;
+                case '\t':  sink.Append("\\t"); break;
+                default:
+                    sink.Append("\\u00");
+                    sink.Append(hex[c >> 4]);
+                    sink.Append(hex[c & 0x0F]);
+            }
+        }
+        sink.Append('"');
     }
 
     Pointer<Value> JsonSerializer::DeserializeToValue(const ara::rest::String &binary)
     {
-        if( IsArray(binary) )           return DeserializeToArray(binary);
-        else if( IsObject(binary) )     return DeserializeToObject(binary);
-        else if( IsInt(binary) )        return DeserializeToInt(binary);
-        else if( IsReal(binary) )       return DeserializeToReal(binary);
-        else                            return DeserializeToString(binary);
+        ErrorCode error;
+        StringView cursor(binary);
+        auto value = ParseValue(cursor, nullptr, 0, error);
+        if (!error) ExpectEnd(cursor, error);
+        Check(error);
+
+        return value;
     }
 
     Pointer<Int> JsonSerializer::DeserializeToInt(const ara::rest::String &binary)
     {
-        return Int::Make(std::stoll(binary));
+        ErrorCode error;
+        StringView cursor(binary);
+        auto value = ParseNumber(cursor, error);
+        if (!error) ExpectEnd(cursor, error);
+        Check(error);
+        if (!value->IsInt()) throw std::invalid_argument("json: expected an integer");
+
+        return Pointer<Int>(static_cast<Int*>(value.release()));
     }
 
     Pointer<Real> JsonSerializer::DeserializeToReal(const ara::rest::String &binary)
     {
-        return Real::Make(std::stold(binary));
+        ErrorCode error;
+        StringView cursor(binary);
+        auto value = ParseNumber(cursor, error);
+        if (!error) ExpectEnd(cursor, error);
+        Check(error);
+        if (value->IsInt()) return Real::Make(static_cast<Int&>(*value).GetValue());
+
+        return Pointer<Real>(static_cast<Real*>(value.release()));
     }
 
     Pointer<String> JsonSerializer::DeserializeToString(const ara::rest::String &binary)
     {
-        return String::Make(binary.substr(1, binary.size() - 2));
+        ErrorCode error;
+        StringView cursor(binary);
+        auto value = ParseString(cursor, error);
+        if (!error) ExpectEnd(cursor, error);
+        Check(error);
+
+        return String::Make(std::move(value));
     }
 
     Pointer<Array> JsonSerializer::DeserializeToArray(const ara::rest::String &binary)
     {
-        auto array = Array::Make();
+        ErrorCode error;
+        auto array = ParseDocument<Array>(binary, nullptr, error);
+        Check(error);
+
+        return array;
+    }
+
+    Pointer<Object> JsonSerializer::DeserializeToObject(const ara::rest::String &binary)
+    {
+        ErrorCode error;
+        auto object = ParseDocument<Object>(binary, nullptr, error);
+        Check(error);
+
+        return object;
+    }
+
+    Pointer<Object> JsonSerializer::DeserializeToObject(const SharedBuffer &binary)
+    {
+        ErrorCode error;
+        auto object = ParseDocument<Object>(*binary, binary, error);
+        Check(error);
+
+        return object;
+    }
+
+    Pointer<Object> JsonSerializer::DeserializeToObject(std::istream &stream)
+    {
+        ErrorCode error;
+        auto object = ParseStream(stream, nullptr, error);
+        Check(error);
+
+        return object;
+    }
+
+    Pointer<Object> JsonSerializer::DeserializeToObject(std::istream &stream, const Projection &projection)
+    {
+        ErrorCode error;
+        auto object = ParseStream(stream, &projection, error);
+        Check(error);
+
+        return object;
+    }
+
+    Pointer<Object> JsonSerializer::DeserializeToObject(const ara::rest::String &binary, const Projection &projection)
+    {
+        ErrorCode error;
+        auto object = ParseProjectedDocument(binary, projection, nullptr, error);
+        Check(error);
+
+        return object;
+    }
+
+    /**
+     * Feeds the parser whatever the stream has buffered, so parsing overlaps with receiving the rest of the body.
+     */
+    Pointer<Object> JsonSerializer::ParseStream(std::istream &stream, const Projection *projection, ErrorCode &error)
+    {
+        JsonPushParser parser(projection);
+        char chunk[kChunkSize];
 
-        std::stringstream token;
-        int depth = 0; bool isString = false;
-        std::for_each(binary.begin() + 1, binary.end(), [this, &token, &depth, &array, &isString](auto &c)
+        while (!error && stream.peek() != std::char_traits<char>::eof())
         {
-            switch (c)
+            std::streamsize count = stream.readsome(chunk, sizeof(chunk));
+            if (count == 0)
             {
-                case ',':
-                    if (depth == 0)
-                    {
-                        array->Append(DeserializeToValue(token.str()));
-                        token.str("");
-                    }
-                    else token << c;
-                    break;
-                case '[':
-                case '{':
-                    token << c; depth++;
-                    break;
-                case ']':
-                    depth--;
-                    if (depth < 0) array->Append(DeserializeToValue(token.str()));
-                    else token << c;
-                    break;
-                case '}':
-                    token << c; depth--;
-                    break;
-                case ' ':
-                    if (isString) token << c;
-                    break;
-                case '"':
-                    isString = !isString;
-                default:
-                    token << c;
+                // Unbuffered streams report nothing available; fall back to the byte peek() just fetched.
+                chunk[0] = static_cast<char>(stream.get());
+                count = 1;
             }
-        });
+            parser.Feed(StringView(chunk, static_cast<std::size_t>(count)), error);
+        }
 
-        return array;
+        return parser.Finish(error);
     }
 
-    Pointer<Object> JsonSerializer::DeserializeToObject(const ara::rest::String &binary)
+    Pointer<Object> JsonSerializer::DeserializeToObject(const ara::rest::String &binary, ErrorCode &error)
     {
-        auto object = Object::Make();
+        return ParseDocument<Object>(binary, nullptr, error);
+    }
+
+    Pointer<Object> JsonSerializer::DeserializeToObject(const SharedBuffer &binary, ErrorCode &error)
+    {
+        return ParseDocument<Object>(*binary, binary, error);
+    }
+
+    Pointer<Object> JsonSerializer::DeserializeToObject(std::istream &stream, ErrorCode &error)
+    {
+        return ParseStream(stream, nullptr, error);
+    }
+
+    Pointer<Field> JsonSerializer::DeserializeToField(const ara::rest::String &binary)
+    {
+        ErrorCode error;
+        StringView cursor(binary);
+        auto field = ParseField(cursor, nullptr, 0, error);
+        if (!error) ExpectEnd(cursor, error);
+        Check(error);
+
+        return field;
+    }
+
+    void JsonSerializer::Check(const ErrorCode &error)
+    {
+        if (error) throw std::invalid_argument("json: " + error.message());
+    }
+
+    template <typename T>
+    Pointer<T> JsonSerializer::ParseDocument(StringView document, const SharedBuffer &source, ErrorCode &error)
+    {
+        constexpr char open = std::is_same<T, Object>::value ? '{' : '[';
 
-        std::stringstream token;
-        int depth = 0; bool isString = false;
-        std::for_each(binary.begin() + 1, binary.end(), [this, &token, &depth, &isString, &object](auto &c)
+        if (document.size() >= kStructuralIndexThreshold)
         {
-            switch (c)
+            auto index = JsonStructuralIndex::Build(document, error);
+            if (error) return nullptr;
+
+            std::size_t token = 0;
+            if (Peek(document, index, token, error) != open)
             {
-                case ',':
-                    if (depth == 0)
-                    {
-                        object->Insert(DeserializeToField(token.str()));
-                        token.str("");
-                    }
-                    else if (!isString)
-                    {
-                        token << c;
-                    }
-                    break;
-                case '[':
-                case '{':
-                    token << c; depth++;
-                    break;
-                case ']':
-                    token << c; depth--;
-                    break;
-                case '}':
-                    depth--;
-                    if (depth < 0) object->Insert(DeserializeToField(token.str()));
-                    else token << c;
-                    break;
-                case ' ':
-                    if (isString) token << c;
-                    break;
-                case '"':
-                    isString = !isString;
-                default:
-                    token << c;
+                if (!error) error = ParseError::kTypeMismatch;
+                return nullptr;
             }
-        });
 
-        return object;
+            Pointer<T> root;
+            if constexpr (std::is_same<T, Object>::value) root = ParseIndexedObject(document, index, token, source, 0, error);
+            else if (document.size() >= kParallelArrayThreshold) root = ParseParallelArray(document, index, token, source, error);
+            else root = ParseIndexedArray(document, index, token, source, 0, error);
+
+            if (!error) ExpectEnd(document.substr(index[token - 1] + 1), error);
+            return error ? nullptr : std::move(root);
+        }
+
+        StringView cursor(document);
+        Pointer<T> root;
+        if constexpr (std::is_same<T, Object>::value) root = ParseObject(cursor, source, 0, error);
+        else root = ParseArray(cursor, source, 0, error);
+
+        if (!error) ExpectEnd(cursor, error);
+        return error ? nullptr : std::move(root);
     }
 
-    Pointer<Field> JsonSerializer::DeserializeToField(const ara::rest::String &binary)
+    /**
+     * Single-pass parser. Every Parse* function consumes its token from the front of the cursor,
+     * so the whole document is scanned exactly once and no intermediate substrings are built.
+     * Values are classified by their first byte.
+     *
+     * When a source buffer is given, strings and field names without escape sequences borrow their
+     * bytes from it; only strings that need unescaping are copied.
+     *
+     * Nothing here throws on malformed input: the first failure is stored in error, the failing
+     * function returns an empty result and every caller unwinds by returning as well.
+     */
+    void JsonSerializer::SkipWhitespace(StringView &cursor)
+    {
+        std::size_t pos = 0;
+        while (pos < cursor.size() && std::isspace(static_cast<unsigned char>(cursor[pos]))) pos++;
+        cursor.remove_prefix(pos);
+    }
+
+    bool JsonSerializer::Expect(StringView &cursor, char token, ErrorCode &error)
+    {
+        SkipWhitespace(cursor);
+        if (cursor.empty())
+        {
+            error = ParseError::kUnexpectedEnd;
+            return false;
+        }
+        if (cursor.front() != token)
+        {
+            error = ParseError::kUnexpectedToken;
+            return false;
+        }
+        cursor.remove_prefix(1);
+
+        return true;
+    }
+
+    void JsonSerializer::ExpectEnd(StringView cursor, ErrorCode &error)
     {
-        auto key = binary.substr(1, binary.find(":") - 2);
-        auto value = DeserializeToValue(binary.substr(binary.find(":") + 1));
+        SkipWhitespace(cursor);
+        if (!cursor.empty()) error = ParseError::kUnexpectedToken;
+    }
+
+    Pointer<Value> JsonSerializer::ParseValue(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error)
+    {
+        SkipWhitespace(cursor);
+        if (cursor.empty())
+        {
+            error = ParseError::kUnexpectedEnd;
+            return nullptr;
+        }
 
-        return Field::Make(key, std::move(value));
+        switch (cursor.front())
+        {
+            case '{':   return ParseObject(cursor, source, depth, error);
+            case '[':   return ParseArray(cursor, source, depth, error);
+            case '"':   return ParseStringValue(cursor, source, error);
+            case '-':
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9':
+                        return ParseNumber(cursor, error);
+            default:    return ParseLiteral(cursor, error);
+        }
     }
 
-    bool JsonSerializer::IsInt(const ara::rest::String &jsonString)
+    bool JsonSerializer::ScanNumber(StringView &cursor, std::int64_t &integer, long double &real, ErrorCode &error)
     {
-        bool result = true;
+        SkipWhitespace(cursor);
+
+        /**
+         * Enforces the RFC 8259 grammar, which from_chars alone does not: no leading zeros, and at least one
+         * digit in the integer part, the fraction and the exponent.
+         */
+        std::size_t length = 0;
+        auto digits = [&cursor, &length]()
+        {
+            std::size_t start = length;
+            while (length < cursor.size() && std::isdigit(static_cast<unsigned char>(cursor[length]))) length++;
+            return length - start;
+        };
+        auto next = [&cursor, &length](const char *set)
+        {
+            if (length >= cursor.size() || StringView(set).find(cursor[length]) == StringView::npos) return false;
+            length++;
+            return true;
+        };
 
-        try
+        next("-");
+        std::size_t integerDigits = digits();
+        bool valid = integerDigits == 1 || (integerDigits > 1 && cursor[length - integerDigits] != '0');
+
+        bool isReal = false;
+        if (valid && next("."))
         {
-            std::stoll(jsonString);
+            isReal = true;
+            valid = digits() != 0;
         }
-        catch (const std::invalid_argument& e)
+        if (valid && next("eE"))
         {
-            result = false;
+            isReal = true;
+            next("+-");
+            valid = digits() != 0;
         }
 
-        return result;
+        const char *first = cursor.data();
+        const char *last = first + length;
+        cursor.remove_prefix(length);
+
+        if (!valid)
+        {
+            error = ParseError::kMalformedNumber;
+            return false;
+        }
+
+        if (!isReal)
+        {
+            auto result = std::from_chars(first, last, integer);
+            if (result.ec == std::errc() && result.ptr == last) return false;
+            if (result.ec != std::errc::result_out_of_range)
+            {
+                error = ParseError::kMalformedNumber;
+                return false;
+            }
+        }
+
+        auto result = std::from_chars(first, last, real);
+        if (result.ec == std::errc::result_out_of_range) error = ParseError::kNumberOutOfRange;
+        else if (result.ec != std::errc() || result.ptr != last) error = ParseError::kMalformedNumber;
+
+        return true;
+    }
+
+    Pointer<Value> JsonSerializer::ParseNumber(StringView &cursor, ErrorCode &error)
+    {
+        Int::ValueType integer = 0;
+        Real::ValueType real = 0;
+        bool isReal = ScanNumber(cursor, integer, real, error);
+
+        if (error) return nullptr;
+        if (isReal) return Real::Make(real);
+
+        return Int::Make(integer);
+    }
+
+    void JsonSerializer::ParseNumber(StringView &cursor, Array &array, ErrorCode &error)
+    {
+        Int::ValueType integer = 0;
+        Real::ValueType real = 0;
+        bool isReal = ScanNumber(cursor, integer, real, error);
+
+        if (error) return;
+        if (isReal) array.AppendReal(real);
+        else        array.AppendInt(integer);
+    }
+
+    Pointer<Value> JsonSerializer::ParseLiteral(StringView &cursor, ErrorCode &error)
+    {
+        /**
+         * The OGM has no Bool or Null node, so the bare literals are kept verbatim as Strings.
+         */
+        for (const char *literal : { "true", "false", "null" })
+        {
+            StringView token(literal);
+            if (cursor.substr(0, token.size()) == token)
+            {
+                cursor.remove_prefix(token.size());
+                return String::Make(ara::rest::String(token));
+            }
+        }
+
+        error = ParseError::kUnexpectedToken;
+        return nullptr;
     }
 
-    bool JsonSerializer::IsReal(const ara::rest::String &jsonString)
+    StringView JsonSerializer::ScanString(StringView &cursor, bool &escaped, ErrorCode &error)
     {
-        bool result = true;
+        escaped = false;
+        if (!Expect(cursor, '"', error)) return StringView();
 
-        try
+        std::size_t end = 0;
+        while (true)
         {
-            std::stold(jsonString);
+            end = cursor.find_first_of("\\\"", end);
+            if (end == StringView::npos)
+            {
+                error = ParseError::kUnterminatedString;
+                return StringView();
+            }
+            if (cursor[end] == '"') break;
+
+            escaped = true;
+            end += 2;
         }
-        catch (const std::invalid_argument& e)
+
+        StringView raw = cursor.substr(0, end);
+        cursor.remove_prefix(end + 1);
+
+        return raw;
+    }
+
+    ara::rest::String JsonSerializer::Unescape(StringView raw, ErrorCode &error)
+    {
+        ara::rest::String result;
+        result.reserve(raw.size());
+
+        while (true)
         {
-            result = false;
+            std::size_t end = raw.find('\\');
+            result.append(raw.data(), std::min(end, raw.size()));
+            if (end == StringView::npos) break;
+
+            if (end + 1 >= raw.size())
+            {
+                error = ParseError::kInvalidEscape;
+                break;
+            }
+            char escaped = raw[end + 1];
+            raw.remove_prefix(end + 2);
+            switch (escaped)
+            {
+                case '"':   result += '"';  break;
+                case '\\':  result += '\\'; break;
+                case '/':   result += '/';  break;
+                case 'b':   result += '\b'; break;
+                case 'f':   result += '\f'; break;
+                case 'n':   result += '\n'; break;
+                case 'r':   result += '\r'; break;
+                case 't':   result += '\t'; break;
+                case 'u':   AppendCodePoint(raw, result, error); break;
+                default:    error = ParseError::kInvalidEscape; break;
+            }
+            if (error) break;
         }
 
         return result;
     }
 
-    bool JsonSerializer::IsArray(const ara::rest::String &jsonString)
+    ara::rest::String JsonSerializer::ParseString(StringView &cursor, ErrorCode &error)
     {
-        return jsonString[0] == '[';
+        bool escaped = false;
+        StringView raw = ScanString(cursor, escaped, error);
+
+        if (error) return ara::rest::String();
+        return escaped ? Unescape(raw, error) : ara::rest::String(raw);
     }
 
-    bool JsonSerializer::IsObject(const ara::rest::String &jsonString)
+    Pointer<String> JsonSerializer::ParseStringValue(StringView &cursor, const SharedBuffer &source, ErrorCode &error)
     {
-        return jsonString[0] == '{';
+        bool escaped = false;
+        StringView raw = ScanString(cursor, escaped, error);
+        if (error) return nullptr;
+
+        if (escaped)
+        {
+            auto value = Unescape(raw, error);
+            if (error) return nullptr;
+
+            return String::Make(std::move(value));
+        }
+        if (source) return String::Make(source, raw);
+
+        return String::Make(ara::rest::String(raw));
     }
 
+    bool JsonSerializer::AppendCodePoint(StringView &cursor, ara::rest::String &out, ErrorCode &error)
+    {
+        auto readHex = [&cursor](std::uint32_t &unit)
+        {
+            if (cursor.size() < 4) return false;
+            auto result = std::from_chars(cursor.data(), cursor.data() + 4, unit, 16);
+            if (result.ptr != cursor.data() + 4) return false;
+            cursor.remove_prefix(4);
+            return true;
+        };
+
+        std::uint32_t codePoint = 0;
+        if (!readHex(codePoint) || (codePoint >= 0xDC00 && codePoint <= 0xDFFF))
+        {
+            error = ParseError::kInvalidEscape;
+            return false;
+        }
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+        {
+            // A high surrogate is only valid as the first half of an escaped pair.
+            std::uint32_t low = 0;
+            bool paired = cursor.substr(0, 2) == "\\u";
+            if (paired)
+            {
+                cursor.remove_prefix(2);
+                paired = readHex(low) && low >= 0xDC00 && low <= 0xDFFF;
+            }
+            if (!paired)
+            {
+                error = ParseError::kInvalidEscape;
+                return false;
+            }
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+
+        if (codePoint < 0x80)
+        {
+            out += static_cast<char>(codePoint);
+        }
+        else if (codePoint < 0x800)
+        {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else if (codePoint < 0x10000)
+        {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else
+        {
+            out += static_cast<char>(0xF0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+
+        return true;
+    }
+
+    Pointer<Array> JsonSerializer::ParseArray(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error)
+    {
+        if (!Expect(cursor, '[', error)) return nullptr;
+        if (depth >= kMaxDepth)
+        {
+            error = ParseError::kNestingTooDeep;
+            return nullptr;
+        }
+
+        auto array = Array::Make();
+        SkipWhitespace(cursor);
+        if (!cursor.empty() && cursor.front() == ']')
+        {
+            cursor.remove_prefix(1);
+            return array;
+        }
+
+        while (true)
+        {
+            SkipWhitespace(cursor);
+            if (!cursor.empty() && IsNumberStart(cursor.front()))
+            {
+                ParseNumber(cursor, *array, error);
+                if (error) return nullptr;
+            }
+            else
+            {
+                auto value = ParseValue(cursor, source, depth + 1, error);
+                if (error) return nullptr;
+                array->Append(std::move(value));
+            }
+
+            SkipWhitespace(cursor);
+            if (cursor.empty())
+            {
+                error = ParseError::kUnexpectedEnd;
+                return nullptr;
+            }
+
+            char c = cursor.front();
+            cursor.remove_prefix(1);
+            if (c == ']') break;
+            if (c != ',')
+            {
+                error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+        }
+
+        return array;
+    }
+
+    Pointer<Object> JsonSerializer::ParseObject(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error)
+    {
+        if (!Expect(cursor, '{', error)) return nullptr;
+        if (depth >= kMaxDepth)
+        {
+            error = ParseError::kNestingTooDeep;
+            return nullptr;
+        }
+
+        auto object = Object::Make();
+        SkipWhitespace(cursor);
+        if (!cursor.empty() && cursor.front() == '}')
+        {
+            cursor.remove_prefix(1);
+            return object;
+        }
+
+        while (true)
+        {
+            auto field = ParseField(cursor, source, depth + 1, error);
+            if (error) return nullptr;
+            object->Insert(std::move(field));
+
+            SkipWhitespace(cursor);
+            if (cursor.empty())
+            {
+                error = ParseError::kUnexpectedEnd;
+                return nullptr;
+            }
+
+            char c = cursor.front();
+            cursor.remove_prefix(1);
+            if (c == '}') break;
+            if (c != ',')
+            {
+                error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+        }
+
+        return object;
+    }
+
+    Pointer<Field> JsonSerializer::ParseField(StringView &cursor, const SharedBuffer &source, std::size_t depth, ErrorCode &error)
+    {
+        bool escaped = false;
+        StringView key = ScanString(cursor, escaped, error);
+        if (error || !Expect(cursor, ':', error)) return nullptr;
+
+        return MakeField(key, escaped, ParseValue(cursor, source, depth, error), source, error);
+    }
+
+    Pointer<Field> JsonSerializer::MakeField(StringView key, bool escaped, Pointer<Value> &&value, const SharedBuffer &source,
+                                             ErrorCode &error)
+    {
+        if (error) return nullptr;
+        if (!escaped) return Field::Make(source, key, std::move(value));
+
+        auto name = Unescape(key, error);
+        if (error) return nullptr;
+
+        return Field::Make(SharedBuffer(), name, std::move(value));
+    }
+
+    /**
+     * Projected parsing. Members the projection does not reach are skipped with SkipValue and never
+     * allocated; a path that ends inside a scalar selects nothing.
+     */
+    void JsonSerializer::SkipValue(StringView &cursor, ErrorCode &error)
+    {
+        SkipWhitespace(cursor);
+        if (cursor.empty())
+        {
+            error = ParseError::kUnexpectedEnd;
+            return;
+        }
+
+        char c = cursor.front();
+        if (c == '"')
+        {
+            bool escaped = false;
+            ScanString(cursor, escaped, error);
+            return;
+        }
+        if (c != '{' && c != '[')
+        {
+            std::size_t length = 0;
+            while (length < cursor.size())
+            {
+                char t = cursor[length];
+                if (!std::isalnum(static_cast<unsigned char>(t)) && t != '-' && t != '+' && t != '.') break;
+                length++;
+            }
+            if (length == 0) error = ParseError::kUnexpectedToken;
+            cursor.remove_prefix(length);
+            return;
+        }
+
+        std::size_t depth = 0;
+        std::size_t pos = 0;
+        while (true)
+        {
+            pos = cursor.find_first_of("\"{}[]", pos);
+            if (pos == StringView::npos)
+            {
+                error = ParseError::kUnexpectedEnd;
+                return;
+            }
+
+            switch (cursor[pos])
+            {
+                case '"':
+                {
+                    StringView rest = cursor.substr(pos);
+                    bool escaped = false;
+                    ScanString(rest, escaped, error);
+                    if (error) return;
+                    pos = cursor.size() - rest.size();
+                    continue;
+                }
+                case '{':
+                case '[':
+                    depth++;
+                    break;
+                default:
+                    if (--depth == 0)
+                    {
+                        cursor.remove_prefix(pos + 1);
+                        return;
+                    }
+                    break;
+            }
+            pos++;
+        }
+    }
+
+    Pointer<Object> JsonSerializer::ParseProjectedDocument(StringView document, const Projection &projection,
+                                                           const SharedBuffer &source, ErrorCode &error)
+    {
+        if (projection.GetRoot().IsSelected()) return ParseDocument<Object>(document, source, error);
+
+        StringView cursor(document);
+        auto object = ParseProjectedObject(cursor, projection.GetRoot(), source, 0, error);
+        if (!error) ExpectEnd(cursor, error);
+
+        return error ? nullptr : std::move(object);
+    }
+
+    Pointer<Value> JsonSerializer::ParseProjectedValue(StringView &cursor, const Projection::Node &node, const SharedBuffer &source,
+                                                       std::size_t depth, ErrorCode &error)
+    {
+        if (node.IsSelected()) return ParseValue(cursor, source, depth, error);
+
+        SkipWhitespace(cursor);
+        if (!cursor.empty() && cursor.front() == '{') return ParseProjectedObject(cursor, node, source, depth, error);
+        if (!cursor.empty() && cursor.front() == '[') return ParseProjectedArray(cursor, node, source, depth, error);
+
+        SkipValue(cursor, error);
+        return nullptr;
+    }
+
+    Pointer<Array> JsonSerializer::ParseProjectedArray(StringView &cursor, const Projection::Node &node, const SharedBuffer &source,
+                                                       std::size_t depth, ErrorCode &error)
+    {
+        if (!Expect(cursor, '[', error)) return nullptr;
+        if (depth >= kMaxDepth)
+        {
+            error = ParseError::kNestingTooDeep;
+            return nullptr;
+        }
+
+        auto array = Array::Make();
+        SkipWhitespace(cursor);
+        if (!cursor.empty() && cursor.front() == ']')
+        {
+            cursor.remove_prefix(1);
+            return array;
+        }
+
+        for (std::size_t index = 0; ; index++)
+        {
+            const Projection::Node *child = node.FindElement(index);
+
+            if (!child)
+            {
+                SkipValue(cursor, error);
+            }
+            else
+            {
+                auto value = ParseProjectedValue(cursor, *child, source, depth + 1, error);
+                if (value) array->Append(std::move(value));
+            }
+            if (error) return nullptr;
+
+            SkipWhitespace(cursor);
+            if (cursor.empty())
+            {
+                error = ParseError::kUnexpectedEnd;
+                return nullptr;
+            }
+
+            char c = cursor.front();
+            cursor.remove_prefix(1);
+            if (c == ']') break;
+            if (c != ',')
+            {
+                error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+        }
+
+        return array;
+    }
+
+    Pointer<Object> JsonSerializer::ParseProjectedObject(StringView &cursor, const Projection::Node &node, const SharedBuffer &source,
+                                                         std::size_t depth, ErrorCode &error)
+    {
+        if (!Expect(cursor, '{', error)) return nullptr;
+        if (depth >= kMaxDepth)
+        {
+            error = ParseError::kNestingTooDeep;
+            return nullptr;
+        }
+
+        auto object = Object::Make();
+        SkipWhitespace(cursor);
+        if (!cursor.empty() && cursor.front() == '}')
+        {
+            cursor.remove_prefix(1);
+            return object;
+        }
+
+        ara::rest::String name;
+        while (true)
+        {
+            bool escaped = false;
+            StringView key = ScanString(cursor, escaped, error);
+            if (error || !Expect(cursor, ':', error)) return nullptr;
+
+            if (escaped)
+            {
+                name = Unescape(key, error);
+                if (error) return nullptr;
+            }
+
+            const Projection::Node *child = node.Find(escaped ? StringView(name) : key);
+            if (!child)
+            {
+                SkipValue(cursor, error);
+            }
+            else
+            {
+                auto value = ParseProjectedValue(cursor, *child, source, depth + 1, error);
+                if (value) object->Insert(MakeField(key, escaped, std::move(value), source, error));
+            }
+            if (error) return nullptr;
+
+            SkipWhitespace(cursor);
+            if (cursor.empty())
+            {
+                error = ParseError::kUnexpectedEnd;
+                return nullptr;
+            }
+
+            char c = cursor.front();
+            cursor.remove_prefix(1);
+            if (c == '}') break;
+            if (c != ',')
+            {
+                error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+        }
+
+        return object;
+    }
+
+    /**
+     * Stage two of the two-stage parser. Containers and strings are located through the structural
+     * index, so whitespace is never rescanned; only scalars are read from the raw document.
+     */
+    char JsonSerializer::Peek(StringView document, const JsonStructuralIndex &index, std::size_t token, ErrorCode &error)
+    {
+        if (token >= index.GetSize())
+        {
+            error = ParseError::kUnexpectedEnd;
+            return '\0';
+        }
+
+        return document[index[token]];
+    }
+
+    Pointer<Value> JsonSerializer::ParseIndexedValue(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                                     std::size_t position, const SharedBuffer &source, std::size_t depth,
+                                                     ErrorCode &error)
+    {
+        StringView cursor = document.substr(position);
+        SkipWhitespace(cursor);
+        if (cursor.empty())
+        {
+            error = ParseError::kUnexpectedEnd;
+            return nullptr;
+        }
+
+        std::size_t start = document.size() - cursor.size();
+        switch (cursor.front())
+        {
+            case '{':
+            case '[':
+            case '"':
+                if (token >= index.GetSize() || index[token] != start)
+                {
+                    error = ParseError::kMalformedStructure;
+                    return nullptr;
+                }
+                break;
+            default:
+                break;
+        }
+
+        switch (cursor.front())
+        {
+            case '{':   return ParseIndexedObject(document, index, token, source, depth, error);
+            case '[':   return ParseIndexedArray(document, index, token, source, depth, error);
+            case '"':
+            {
+                auto value = ParseStringValue(cursor, source, error);
+                token++;
+                return value;
+            }
+            default:
+            {
+                auto value = ParseValue(cursor, source, depth, error);
+                if (error) return nullptr;
+
+                SkipWhitespace(cursor);
+                if (token < index.GetSize() && index[token] != document.size() - cursor.size())
+                {
+                    error = ParseError::kUnexpectedToken;
+                    return nullptr;
+                }
+                return value;
+            }
+        }
+    }
+
+    Pointer<Array> JsonSerializer::ParseIndexedArray(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                                     const SharedBuffer &source, std::size_t depth, ErrorCode &error)
+    {
+        if (depth >= kMaxDepth)
+        {
+            error = ParseError::kNestingTooDeep;
+            return nullptr;
+        }
+
+        auto array = Array::Make();
+
+        // Scalars are not structural, so the next token is also ']' for an array of one scalar.
+        StringView inner = document.substr(index[token] + 1);
+        SkipWhitespace(inner);
+        token++;
+        char c = Peek(document, index, token, error);
+        if (error) return nullptr;
+        if (c == ']' && index[token] == document.size() - inner.size())
+        {
+            token++;
+            return array;
+        }
+
+        while (true)
+        {
+            ParseIndexedElement(document, index, token, index[token - 1] + 1, *array, source, depth + 1, error);
+            if (error) return nullptr;
+
+            c = Peek(document, index, token, error);
+            if (error) return nullptr;
+            token++;
+            if (c == ']') break;
+            if (c != ',')
+            {
+                error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+        }
+
+        return array;
+    }
+
+    /**
+     * Numbers are scanned straight into a cell. Like the scalars ParseIndexedValue parses, a number must
+     * end where the next structural character starts.
+     */
+    void JsonSerializer::ParseIndexedElement(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                             std::size_t position, Array &array, const SharedBuffer &source, std::size_t depth,
+                                             ErrorCode &error)
+    {
+        StringView cursor = document.substr(position);
+        SkipWhitespace(cursor);
+        if (cursor.empty() || !IsNumberStart(cursor.front()))
+        {
+            auto value = ParseIndexedValue(document, index, token, position, source, depth, error);
+            if (!error) array.Append(std::move(value));
+            return;
+        }
+
+        ParseNumber(cursor, array, error);
+        if (error) return;
+
+        SkipWhitespace(cursor);
+        if (token < index.GetSize() && index[token] != document.size() - cursor.size()) error = ParseError::kUnexpectedToken;
+    }
+
+    /**
+     * Splits a top-level array at its depth-one commas and parses contiguous runs of elements concurrently.
+     * The runs only read the document and the index; their arrays are spliced in order, and the result
+     * stays packed if all of them are.
+     * Every element must end exactly at the separator the split found for it, so a document the split
+     * misjudged is still rejected.
+     */
+    Pointer<Array> JsonSerializer::ParseParallelArray(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                                      const SharedBuffer &source, ErrorCode &error)
+    {
+        std::vector<std::size_t> separators{ token };
+        std::size_t close = index.GetSize();
+        std::size_t depth = 0;
+        for (std::size_t i = token; i < index.GetSize(); i++)
+        {
+            char c = document[index[i]];
+            if (c == '[' || c == '{')                   depth++;
+            else if ((c == ']' || c == '}') && --depth == 0)
+            {
+                close = i;
+                break;
+            }
+            else if (c == ',' && depth == 1)            separators.push_back(i);
+        }
+
+        WorkerPool &pool = WorkerPool::GetInstance();
+        std::size_t workers = std::min<std::size_t>(pool.GetConcurrency(), separators.size() / kMinElementsPerTask);
+        if (close == index.GetSize() || workers < 2) return ParseIndexedArray(document, index, token, source, 0, error);
+
+        auto parseRun = [&](std::size_t first, std::size_t last, Array &values, ErrorCode &runError)
+        {
+            for (std::size_t element = first; element < last && !runError; element++)
+            {
+                std::size_t next = separators[element] + 1;
+                ParseIndexedElement(document, index, next, index[separators[element]] + 1, values, source, 1, runError);
+                if (runError) return;
+
+                if (next != (element + 1 < separators.size() ? separators[element + 1] : close))
+                {
+                    runError = ParseError::kUnexpectedToken;
+                    return;
+                }
+            }
+        };
+
+        std::vector<Pointer<Array>> runs;
+        for (std::size_t run = 0; run < workers; run++) runs.push_back(Array::Make());
+
+        std::vector<ErrorCode> errors(workers);
+        std::size_t perRun = (separators.size() + workers - 1) / workers;
+
+        pool.Run(workers, [&](std::size_t run)
+        {
+            std::size_t first = std::min(run * perRun, separators.size());
+            std::size_t last = std::min(first + perRun, separators.size());
+            parseRun(first, last, *runs[run], errors[run]);
+        });
+
+        for (const auto &runError : errors)
+        {
+            if (!runError) continue;
+            error = runError;
+            return nullptr;
+        }
+
+        if (document[index[close]] != ']')
+        {
+            error = ParseError::kUnexpectedToken;
+            return nullptr;
+        }
+
+        auto array = std::move(runs[0]);
+        for (std::size_t run = 1; run < workers; run++) array->Splice(std::move(*runs[run]));
+        token = close + 1;
+
+        return array;
+    }
+
+    Pointer<Object> JsonSerializer::ParseIndexedObject(StringView document, const JsonStructuralIndex &index, std::size_t &token,
+                                                       const SharedBuffer &source, std::size_t depth, ErrorCode &error)
+    {
+        if (depth >= kMaxDepth)
+        {
+            error = ParseError::kNestingTooDeep;
+            return nullptr;
+        }
+
+        auto object = Object::Make();
+
+        token++;
+        char c = Peek(document, index, token, error);
+        if (error) return nullptr;
+        if (c == '}')
+        {
+            token++;
+            return object;
+        }
+
+        while (true)
+        {
+            if (Peek(document, index, token, error) != '"')
+            {
+                if (!error) error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+
+            StringView cursor = document.substr(index[token]);
+            token++;
+
+            if (Peek(document, index, token, error) != ':')
+            {
+                if (!error) error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+            token++;
+
+            auto field = ParseIndexedField(cursor, document, index, token, source, depth + 1, error);
+            if (error) return nullptr;
+            object->Insert(std::move(field));
+
+            c = Peek(document, index, token, error);
+            if (error) return nullptr;
+            token++;
+            if (c == '}') break;
+            if (c != ',')
+            {
+                error = ParseError::kUnexpectedToken;
+                return nullptr;
+            }
+        }
+
+        return object;
+    }
+
+    Pointer<Field> JsonSerializer::ParseIndexedField(StringView &cursor, StringView document, const JsonStructuralIndex &index,
+                                                     std::size_t &token, const SharedBuffer &source, std::size_t depth,
+                                                     ErrorCode &error)
+    {
+        bool escaped = false;
+        StringView key = ScanString(cursor, escaped, error);
+        if (error) return nullptr;
+
+        auto value = ParseIndexedValue(document, index, token, index[token - 1] + 1, source, depth, error);
+
+        return MakeField(key, escaped, std::move(value), source, error);
+    }
+
+    void JsonStructWriter::WriteInt(std::int64_t value)
+    {
+        JsonSerializer::SerializeNumber(value, sink_);
+    }
+
+    void JsonStructWriter::WriteReal(long double value)
+    {
+        JsonSerializer::SerializeNumber(value, sink_);
+    }
+
+    void JsonStructWriter::WriteBool(bool value)
+    {
+        sink_.Append(value ? StringView("true") : StringView("false"));
+    }
+
+    void JsonStructWriter::WriteString(StringView value)
+    {
+        JsonSerializer::SerializeEscaped(value, sink_);
+    }
+
+    void JsonStructWriter::BeginObject(std::size_t)
+    {
+        sink_.Append("{ ");
+    }
+
+    void JsonStructWriter::WriteKey(StringView name, std::size_t index)
+    {
+        if (index != 0) sink_.Append(", ");
+        JsonSerializer::SerializeEscaped(name, sink_);
+        sink_.Append(" : ");
+    }
+
+    void JsonStructWriter::EndObject()
+    {
+        sink_.Append(" }");
+    }
+
+    void JsonStructWriter::BeginArray(std::size_t)
+    {
+        sink_.Append("[ ");
+    }
+
+    void JsonStructWriter::WriteElement(std::size_t index)
+    {
+        if (index != 0) sink_.Append(", ");
+    }
+
+    void JsonStructWriter::EndArray()
+    {
+        sink_.Append(" ]");
+    }
+
+    std::int64_t JsonStructReader::ReadInt()
+    {
+        ErrorCode error;
+        std::int64_t integer = 0;
+        long double real = 0;
+        bool isReal = JsonSerializer::ScanNumber(cursor_, integer, real, error);
+        JsonSerializer::Check(error);
+        if (isReal) throw std::invalid_argument("json: expected an integer");
+
+        return integer;
+    }
+
+    long double JsonStructReader::ReadReal()
+    {
+        ErrorCode error;
+        std::int64_t integer = 0;
+        long double real = 0;
+        bool isReal = JsonSerializer::ScanNumber(cursor_, integer, real, error);
+        JsonSerializer::Check(error);
+        if (isReal) return real;
+
+        return static_cast<long double>(integer);
+    }
+
+    bool JsonStructReader::ReadBool()
+    {
+        JsonSerializer::SkipWhitespace(cursor_);
+
+        if (cursor_.substr(0, 4) == "true")
+        {
+            cursor_.remove_prefix(4);
+            return true;
+        }
+        if (cursor_.substr(0, 5) == "false")
+        {
+            cursor_.remove_prefix(5);
+            return false;
+        }
+        if (!cursor_.empty() && cursor_.front() == '"')
+        {
+            // The OGM keeps literals as Strings, which this serializer writes quoted.
+            ErrorCode error;
+            bool escaped = false;
+            StringView literal = JsonSerializer::ScanString(cursor_, escaped, error);
+            if (literal == "true" || literal == "false") return literal == "true";
+        }
+
+        throw std::invalid_argument("json: expected a boolean");
+    }
+
+    void JsonStructReader::ReadString(ara::rest::String &value)
+    {
+        ErrorCode error;
+        bool escaped = false;
+        StringView raw = JsonSerializer::ScanString(cursor_, escaped, error);
+
+        if (escaped && !error) value = JsonSerializer::Unescape(raw, error);
+        else value.assign(raw.data(), raw.size());
+        JsonSerializer::Check(error);
+    }
+
+    std::size_t JsonStructReader::BeginObject()
+    {
+        ErrorCode error;
+        JsonSerializer::Expect(cursor_, '{', error);
+        JsonSerializer::Check(error);
+        return StringView::npos;
+    }
+
+    bool JsonStructReader::NextKey(std::size_t, std::size_t index, StringView &name)
+    {
+        JsonSerializer::SkipWhitespace(cursor_);
+        if (cursor_.empty()) throw std::invalid_argument("json: unterminated object");
+        if (cursor_.front() == '}')
+        {
+            cursor_.remove_prefix(1);
+            return false;
+        }
+
+        ErrorCode error;
+        bool escaped = false;
+        if (index == 0 || JsonSerializer::Expect(cursor_, ',', error)) name = JsonSerializer::ScanString(cursor_, escaped, error);
+        if (escaped && !error)
+        {
+            name_ = JsonSerializer::Unescape(name, error);
+            name = name_;
+        }
+        if (!error) JsonSerializer::Expect(cursor_, ':', error);
+        JsonSerializer::Check(error);
+
+        return true;
+    }
+
+    std::size_t JsonStructReader::BeginArray()
+    {
+        ErrorCode error;
+        JsonSerializer::Expect(cursor_, '[', error);
+        JsonSerializer::Check(error);
+        return StringView::npos;
+    }
+
+    bool JsonStructReader::NextElement(std::size_t, std::size_t index)
+    {
+        JsonSerializer::SkipWhitespace(cursor_);
+        if (cursor_.empty()) throw std::invalid_argument("json: unterminated array");
+        if (cursor_.front() == ']')
+        {
+            cursor_.remove_prefix(1);
+            return false;
+        }
+
+        ErrorCode error;
+        if (index != 0) JsonSerializer::Expect(cursor_, ',', error);
+        JsonSerializer::Check(error);
+
+        return true;
+    }
+
+    void JsonStructReader::Skip()
+    {
+        ErrorCode error;
+        JsonSerializer::SkipValue(cursor_, error);
+        JsonSerializer::Check(error);
+    }
+
+}
 }
 }
-}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#include <ara/rest/ogm/serializer/json_structural_index.h>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define REST_JSON_INDEX_X86
+#endif
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        constexpr std::size_t kBlockSize = 64;
+
+        /**
+         * Bit i of each mask describes byte i of a 64-byte block.
+         */
+        struct BlockMasks
+        {
+            std::uint64_t quote;
+            std::uint64_t backslash;
+            std::uint64_t structural;
+        };
+
+        using ClassifyFunction = BlockMasks (*)(const char *block);
+
+        BlockMasks ClassifyScalar(const char *block)
+        {
+            BlockMasks masks{0, 0, 0};
+            for (std::size_t i = 0; i < kBlockSize; i++)
+            {
+                std::uint64_t bit = std::uint64_t{1} << i;
+                switch (block[i])
+                {
+                    case '"':   masks.quote |= bit; break;
+                    case '\\':  masks.backslash |= bit; break;
+                    case '{': case '}': case '[': case ']': case ':': case ',':
+                                masks.structural |= bit; break;
+                    default:    break;
+                }
+            }
+            return masks;
+        }
+
+#ifdef REST_JSON_INDEX_X86
+        __attribute__((target("sse2")))
+        std::uint64_t MatchSse2(const char *block, char c)
+        {
+            const __m128i needle = _mm_set1_epi8(c);
+            std::uint64_t mask = 0;
+            for (std::size_t i = 0; i < kBlockSize; i += 16)
+            {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+                auto bits = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+                mask |= static_cast<std::uint64_t>(bits & 0xFFFF) << i;
+            }
+            return mask;
+        }
+
+        __attribute__((target("sse2")))
+        BlockMasks ClassifySse2(const char *block)
+        {
+            BlockMasks masks;
+            masks.quote = MatchSse2(block, '"');
+            masks.backslash = MatchSse2(block, '\\');
+            masks.structural = MatchSse2(block, '{') | MatchSse2(block, '}') | MatchSse2(block, '[')
+                             | MatchSse2(block, ']') | MatchSse2(block, ':') | MatchSse2(block, ',');
+            return masks;
+        }
+
+        __attribute__((target("avx2")))
+        std::uint64_t MatchAvx2(__m256i low, __m256i high, char c)
+        {
+            const __m256i needle = _mm256_set1_epi8(c);
+            auto lowBits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+            auto highBits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+            return static_cast<std::uint64_t>(lowBits) | (static_cast<std::uint64_t>(highBits) << 32);
+        }
+
+        __attribute__((target("avx2")))
+        BlockMasks ClassifyAvx2(const char *block)
+        {
+            __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+            __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+
+            BlockMasks masks;
+            masks.quote = MatchAvx2(low, high, '"');
+            masks.backslash = MatchAvx2(low, high, '\\');
+            masks.structural = MatchAvx2(low, high, '{') | MatchAvx2(low, high, '}') | MatchAvx2(low, high, '[')
+                             | MatchAvx2(low, high, ']') | MatchAvx2(low, high, ':') | MatchAvx2(low, high, ',');
+            return masks;
+        }
+#endif
+
+        struct Classifier
+        {
+            ClassifyFunction function;
+            const char *name;
+        };
+
+        const Classifier &SelectClassifier()
+        {
+            static const Classifier classifier = []() -> Classifier
+            {
+#ifdef REST_JSON_INDEX_X86
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) return { ClassifyAvx2, "avx2" };
+                if (__builtin_cpu_supports("sse2")) return { ClassifySse2, "sse2" };
+#endif
+                return { ClassifyScalar, "scalar" };
+            }();
+
+            return classifier;
+        }
+
+        /**
+         * Marks every byte preceded by an odd run of backslashes. Backslashes are rare in practice,
+         * so walking them one by one is cheaper than the branch-free carry arithmetic.
+         */
+        std::uint64_t FindEscaped(std::uint64_t backslash, bool &carry)
+        {
+            std::uint64_t escaped = carry ? 1 : 0;
+            carry = false;
+
+            while (backslash)
+            {
+                int bit = __builtin_ctzll(backslash);
+                backslash &= backslash - 1;
+
+                if ((escaped >> bit) & 1) continue;
+                if (bit == 63) carry = true;
+                else escaped |= std::uint64_t{1} << (bit + 1);
+            }
+
+            return escaped;
+        }
+
+        /**
+         * Bit i of the result is the XOR of bits 0..i of the input, which turns quote positions into a
+         * mask covering each string from its opening quote up to (excluding) its closing quote.
+         */
+        std::uint64_t PrefixXor(std::uint64_t bits)
+        {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+    }
+
+    JsonStructuralIndex JsonStructuralIndex::Build(StringView document)
+    {
+        ErrorCode error;
+        auto index = Build(document, error);
+        if (error) throw std::invalid_argument("json: " + error.message());
+
+        return index;
+    }
+
+    JsonStructuralIndex JsonStructuralIndex::Build(StringView document, ErrorCode &error)
+    {
+        const ClassifyFunction classify = SelectClassifier().function;
+
+        JsonStructuralIndex index;
+        if (document.size() > std::numeric_limits<PositionType>::max())
+        {
+            error = ParseError::kDocumentTooLarge;
+            return index;
+        }
+
+        index.positions_.reserve(document.size() / 8);
+
+        bool escapeCarry = false;
+        std::uint64_t inStringCarry = 0;
+
+        char padded[kBlockSize];
+        for (std::size_t offset = 0; offset < document.size(); offset += kBlockSize)
+        {
+            const char *block = document.data() + offset;
+            if (document.size() - offset < kBlockSize)
+            {
+                std::memset(padded, ' ', kBlockSize);
+                std::memcpy(padded, block, document.size() - offset);
+                block = padded;
+            }
+
+            BlockMasks masks = classify(block);
+
+            std::uint64_t quotes = masks.quote & ~FindEscaped(masks.backslash, escapeCarry);
+            std::uint64_t inString = PrefixXor(quotes) ^ inStringCarry;
+            inStringCarry = (inString >> 63) ? ~std::uint64_t{0} : 0;
+
+            std::uint64_t structural = (masks.structural & ~inString) | (quotes & inString);
+            while (structural)
+            {
+                int bit = __builtin_ctzll(structural);
+                structural &= structural - 1;
+                index.positions_.push_back(static_cast<PositionType>(offset + bit));
+            }
+        }
+
+        if (inStringCarry) error = ParseError::kUnterminatedString;
+
+        return index;
+    }
+
+    const char *JsonStructuralIndex::GetImplementationName() noexcept
+    {
+        return SelectClassifier().name;
+    }
+
+}
+}
+}
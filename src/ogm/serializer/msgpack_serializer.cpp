@@ -0,0 +1,682 @@
+#include <ara/rest/ogm/serializer/msgpack_serializer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <ara/rest/ogm/value.h>
+#include <ara/rest/ogm/int.h>
+#include <ara/rest/ogm/real.h>
+#include <ara/rest/ogm/string.h>
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/field.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        constexpr std::uint8_t kFixMap      = 0x80;
+        constexpr std::uint8_t kFixArray    = 0x90;
+        constexpr std::uint8_t kFixStr      = 0xA0;
+        constexpr std::uint8_t kNil         = 0xC0;
+        constexpr std::uint8_t kFalse       = 0xC2;
+        constexpr std::uint8_t kTrue        = 0xC3;
+        constexpr std::uint8_t kBin8        = 0xC4;
+        constexpr std::uint8_t kBin16       = 0xC5;
+        constexpr std::uint8_t kBin32       = 0xC6;
+        constexpr std::uint8_t kFloat32     = 0xCA;
+        constexpr std::uint8_t kFloat64     = 0xCB;
+        constexpr std::uint8_t kUint8       = 0xCC;
+        constexpr std::uint8_t kUint16      = 0xCD;
+        constexpr std::uint8_t kUint32      = 0xCE;
+        constexpr std::uint8_t kUint64      = 0xCF;
+        constexpr std::uint8_t kInt8        = 0xD0;
+        constexpr std::uint8_t kInt16       = 0xD1;
+        constexpr std::uint8_t kInt32       = 0xD2;
+        constexpr std::uint8_t kInt64       = 0xD3;
+        constexpr std::uint8_t kStr8        = 0xD9;
+        constexpr std::uint8_t kStr16       = 0xDA;
+        constexpr std::uint8_t kStr32       = 0xDB;
+        constexpr std::uint8_t kArray16     = 0xDC;
+        constexpr std::uint8_t kArray32     = 0xDD;
+        constexpr std::uint8_t kMap16       = 0xDE;
+        constexpr std::uint8_t kMap32       = 0xDF;
+        constexpr std::uint8_t kNegFixInt   = 0xE0;
+
+        Pointer<Value> MakeUnsigned(std::uint64_t value)
+        {
+            if (value > static_cast<std::uint64_t>(std::numeric_limits<Int::ValueType>::max()))
+            {
+                return Real::Make(static_cast<Real::ValueType>(value));
+            }
+            return Int::Make(static_cast<Int::ValueType>(value));
+        }
+
+        template<typename T>
+        T ToSigned(std::uint64_t value)
+        {
+            using Unsigned = typename std::make_unsigned<T>::type;
+
+            T result;
+            auto bits = static_cast<Unsigned>(value);
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Value &node, OutputSink &sink)
+    {
+        if (node.IsInt())          Serialize(static_cast<Int&>(node), sink);
+        else if (node.IsReal())    Serialize(static_cast<Real&>(node), sink);
+        else if (node.IsString())  Serialize(static_cast<String&>(node), sink);
+        else if (node.IsArray())   Serialize(static_cast<Array&>(node), sink);
+        else if (node.IsObject())  Serialize(static_cast<Object&>(node), sink);
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Int &node, OutputSink &sink)
+    {
+        WriteInt(node.GetValue(), sink);
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Real &node, OutputSink &sink)
+    {
+        WriteReal(node.GetValue(), sink);
+    }
+
+    void MsgPackSerializer::Serialize(ogm::String &node, OutputSink &sink)
+    {
+        WriteText(node.GetView(), sink);
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Array &node, OutputSink &sink)
+    {
+        WriteHead(kFixArray, 16, kArray16, node.GetSize(), sink);
+
+        if (node.IsPacked())
+        {
+            SerializeChildren(node, node.GetSize(), sink, [&node](std::size_t index, OutputSink &out)
+            {
+                WriteCell(node, index, out);
+            });
+            return;
+        }
+
+        auto values = static_cast<const ogm::Array&>(node).GetValues().Begin();
+        SerializeChildren(node, node.GetSize(), sink, [this, values](std::size_t index, OutputSink &out)
+        {
+            Serialize(*values[index], out);
+        });
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Object &node, OutputSink &sink)
+    {
+        WriteHead(kFixMap, 16, kMap16, node.GetSize(), sink);
+
+        auto fields = static_cast<const ogm::Object&>(node).GetFields().Begin();
+        SerializeChildren(node, node.GetSize(), sink, [this, fields](std::size_t index, OutputSink &out)
+        {
+            Serialize(*fields[index], out);
+        });
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Field &node, OutputSink &sink)
+    {
+        WriteText(node.GetNameView(), sink);
+        Serialize(node.GetValue(), sink);
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Value &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (node.IsArray())         Serialize(static_cast<Array&>(node), projection, sink);
+        else if (node.IsObject())   Serialize(static_cast<Object&>(node), projection, sink);
+        else                        Serialize(node, sink);
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Array &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (projection.IsSelected())
+        {
+            Serialize(node, sink);
+            return;
+        }
+
+        WriteHead(kFixArray, 16, kArray16, Projection::Count(node, projection), sink);
+
+        if (node.IsPacked())
+        {
+            for (std::size_t index = 0; index < node.GetSize(); index++)
+            {
+                if (Projection::Select(projection, index)) WriteCell(node, index, sink);
+            }
+            return;
+        }
+
+        std::size_t index = 0;
+        auto valueIterator = static_cast<const ogm::Array&>(node).GetValues();
+        std::for_each(valueIterator.Begin(), valueIterator.End(), [this, &projection, &sink, &index](const Pointer<ogm::Value> &value)
+        {
+            const Projection::Node *child = Projection::Select(projection, index++, *value);
+            if (child) Serialize(*value, *child, sink);
+        });
+    }
+
+    void MsgPackSerializer::Serialize(ogm::Object &node, const Projection::Node &projection, OutputSink &sink)
+    {
+        if (projection.IsSelected())
+        {
+            Serialize(node, sink);
+            return;
+        }
+
+        WriteHead(kFixMap, 16, kMap16, Projection::Count(node, projection), sink);
+
+        auto fieldIterator = static_cast<const ogm::Object&>(node).GetFields();
+        std::for_each(fieldIterator.Begin(), fieldIterator.End(), [this, &projection, &sink](const Pointer<ogm::Field> &field)
+        {
+            const Projection::Node *child = Projection::Select(projection, field->GetNameView(), field->GetValue());
+            if (!child) return;
+
+            WriteText(field->GetNameView(), sink);
+            Serialize(field->GetValue(), *child, sink);
+        });
+    }
+
+    void MsgPackSerializer::WriteCell(const Array &array, std::size_t index, OutputSink &sink)
+    {
+        if (array.IsRealCell(index))    WriteReal(array.GetCell(index).real, sink);
+        else                            WriteInt(array.GetCell(index).integer, sink);
+    }
+
+    void MsgPackSerializer::WriteBigEndian(std::uint8_t marker, std::uint64_t value, std::size_t size, OutputSink &sink)
+    {
+        char buffer[9];
+        buffer[0] = static_cast<char>(marker);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            buffer[1 + i] = static_cast<char>(value >> (8 * (size - 1 - i)));
+        }
+        sink.Append(buffer, 1 + size);
+    }
+
+    void MsgPackSerializer::WriteHead(std::uint8_t fixBase, std::uint64_t fixLimit, std::uint8_t marker16,
+                                      std::uint64_t size, OutputSink &sink)
+    {
+        if (size < fixLimit)            sink.Append(static_cast<char>(fixBase | size));
+        else if (size <= 0xFFFF)        WriteBigEndian(marker16, size, 2, sink);
+        else if (size <= 0xFFFFFFFF)    WriteBigEndian(marker16 + 1, size, 4, sink);
+        else                            throw std::invalid_argument("msgpack: container or string too large");
+    }
+
+    void MsgPackSerializer::WriteInt(std::int64_t value, OutputSink &sink)
+    {
+        if (value >= 0)
+        {
+            auto magnitude = static_cast<std::uint64_t>(value);
+
+            if (magnitude < 0x80)                 sink.Append(static_cast<char>(magnitude));
+            else if (magnitude <= 0xFF)           WriteBigEndian(kUint8, magnitude, 1, sink);
+            else if (magnitude <= 0xFFFF)         WriteBigEndian(kUint16, magnitude, 2, sink);
+            else if (magnitude <= 0xFFFFFFFF)     WriteBigEndian(kUint32, magnitude, 4, sink);
+            else                                  WriteBigEndian(kUint64, magnitude, 8, sink);
+        }
+        else
+        {
+            auto bits = static_cast<std::uint64_t>(value);
+
+            if (value >= -32)                     sink.Append(static_cast<char>(bits));
+            else if (value >= INT8_MIN)           WriteBigEndian(kInt8, bits, 1, sink);
+            else if (value >= INT16_MIN)          WriteBigEndian(kInt16, bits, 2, sink);
+            else if (value >= INT32_MIN)          WriteBigEndian(kInt32, bits, 4, sink);
+            else                                  WriteBigEndian(kInt64, bits, 8, sink);
+        }
+    }
+
+    void MsgPackSerializer::WriteReal(long double real, OutputSink &sink)
+    {
+        auto value = static_cast<double>(real);
+        auto narrow = static_cast<float>(value);
+
+        if (static_cast<double>(narrow) == value || std::isnan(value))
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &narrow, sizeof(bits));
+            WriteBigEndian(kFloat32, bits, 4, sink);
+        }
+        else
+        {
+            std::uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            WriteBigEndian(kFloat64, bits, 8, sink);
+        }
+    }
+
+    void MsgPackSerializer::WriteText(StringView text, OutputSink &sink)
+    {
+        if (text.size() >= 32 && text.size() <= 0xFF) WriteBigEndian(kStr8, text.size(), 1, sink);
+        else WriteHead(kFixStr, 32, kStr16, text.size(), sink);
+
+        sink.Append(text);
+    }
+
+    Pointer<Value> MsgPackSerializer::DeserializeToValue(const ara::rest::String &binary)
+    {
+        Reader reader(binary, nullptr);
+        return ParseValue(reader, 0);
+    }
+
+    Pointer<Int> MsgPackSerializer::DeserializeToInt(const ara::rest::String &binary)
+    {
+        auto value = DeserializeToValue(binary);
+        if (!value->IsInt()) throw std::invalid_argument("msgpack: expected an integer");
+
+        return Pointer<Int>(static_cast<Int*>(value.release()));
+    }
+
+    Pointer<Real> MsgPackSerializer::DeserializeToReal(const ara::rest::String &binary)
+    {
+        auto value = DeserializeToValue(binary);
+        if (value->IsInt()) return Real::Make(static_cast<Int&>(*value).GetValue());
+        if (!value->IsReal()) throw std::invalid_argument("msgpack: expected a number");
+
+        return Pointer<Real>(static_cast<Real*>(value.release()));
+    }
+
+    Pointer<String> MsgPackSerializer::DeserializeToString(const ara::rest::String &binary)
+    {
+        auto value = DeserializeToValue(binary);
+        if (!value->IsString()) throw std::invalid_argument("msgpack: expected a string");
+
+        return Pointer<String>(static_cast<String*>(value.release()));
+    }
+
+    Pointer<Array> MsgPackSerializer::DeserializeToArray(const ara::rest::String &binary)
+    {
+        auto value = DeserializeToValue(binary);
+        if (!value->IsArray()) throw std::invalid_argument("msgpack: expected an array");
+
+        return Pointer<Array>(static_cast<Array*>(value.release()));
+    }
+
+    Pointer<Object> MsgPackSerializer::DeserializeToObject(const ara::rest::String &binary)
+    {
+        Reader reader(binary, nullptr);
+        return ParseObject(reader);
+    }
+
+    Pointer<Object> MsgPackSerializer::DeserializeToObject(const SharedBuffer &binary)
+    {
+        Reader reader(*binary, binary);
+        return ParseObject(reader);
+    }
+
+    Pointer<Object> MsgPackSerializer::DeserializeToObject(std::istream &stream)
+    {
+        Reader reader(stream);
+        return ParseObject(reader);
+    }
+
+    Pointer<Field> MsgPackSerializer::DeserializeToField(const ara::rest::String &binary)
+    {
+        Reader reader(binary, nullptr);
+        return ParseField(reader, 0);
+    }
+
+    Pointer<Value> MsgPackSerializer::ParseValue(Reader &reader, std::size_t depth)
+    {
+        return ParseValue(reader, reader.ReadByte(), depth);
+    }
+
+    Pointer<Value> MsgPackSerializer::ParseValue(Reader &reader, std::uint8_t marker, std::size_t depth)
+    {
+        if (marker < kFixMap)       return Int::Make(marker);
+        if (marker >= kNegFixInt)   return Int::Make(ToSigned<std::int8_t>(marker));
+        if (marker < kFixArray)     return ParseObject(reader, marker & 0x0F, depth);
+        if (marker < kFixStr)       return ParseArray(reader, marker & 0x0F, depth);
+        if (marker < kNil)          return ParseString(reader, marker & 0x1F);
+
+        switch (marker)
+        {
+            case kNil:      return String::Make("null");
+            case kFalse:    return String::Make("false");
+            case kTrue:     return String::Make("true");
+            case kBin8:
+            case kStr8:     return ParseString(reader, reader.ReadBigEndian(1));
+            case kBin16:
+            case kStr16:    return ParseString(reader, reader.ReadBigEndian(2));
+            case kBin32:
+            case kStr32:    return ParseString(reader, reader.ReadBigEndian(4));
+            case kFloat32:
+            {
+                auto bits = static_cast<std::uint32_t>(reader.ReadBigEndian(4));
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return Real::Make(value);
+            }
+            case kFloat64:
+            {
+                std::uint64_t bits = reader.ReadBigEndian(8);
+                double value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return Real::Make(value);
+            }
+            case kUint8:    return Int::Make(static_cast<Int::ValueType>(reader.ReadBigEndian(1)));
+            case kUint16:   return Int::Make(static_cast<Int::ValueType>(reader.ReadBigEndian(2)));
+            case kUint32:   return Int::Make(static_cast<Int::ValueType>(reader.ReadBigEndian(4)));
+            case kUint64:   return MakeUnsigned(reader.ReadBigEndian(8));
+            case kInt8:     return Int::Make(ToSigned<std::int8_t>(reader.ReadBigEndian(1)));
+            case kInt16:    return Int::Make(ToSigned<std::int16_t>(reader.ReadBigEndian(2)));
+            case kInt32:    return Int::Make(ToSigned<std::int32_t>(reader.ReadBigEndian(4)));
+            case kInt64:    return Int::Make(ToSigned<std::int64_t>(reader.ReadBigEndian(8)));
+            case kArray16:  return ParseArray(reader, reader.ReadBigEndian(2), depth);
+            case kArray32:  return ParseArray(reader, reader.ReadBigEndian(4), depth);
+            case kMap16:    return ParseObject(reader, reader.ReadBigEndian(2), depth);
+            case kMap32:    return ParseObject(reader, reader.ReadBigEndian(4), depth);
+            default:
+                throw std::invalid_argument("msgpack: unsupported type");
+        }
+    }
+
+    Pointer<String> MsgPackSerializer::ParseString(Reader &reader, std::uint64_t size)
+    {
+        StringView bytes = reader.ReadBytes(static_cast<std::size_t>(size));
+        if (reader.GetSource()) return String::Make(reader.GetSource(), bytes);
+
+        return String::Make(ara::rest::String(bytes));
+    }
+
+    Pointer<Array> MsgPackSerializer::ParseArray(Reader &reader, std::uint64_t size, std::size_t depth)
+    {
+        if (depth >= kMaxDepth) throw std::invalid_argument("msgpack: containers nested too deeply");
+
+        auto array = Array::Make();
+        for (std::uint64_t i = 0; i < size; i++) ParseElement(reader, *array, depth + 1);
+
+        return array;
+    }
+
+    /**
+     * Integers in the range of an Int and floats are appended as packed cells; anything else as a node.
+     */
+    void MsgPackSerializer::ParseElement(Reader &reader, Array &array, std::size_t depth)
+    {
+        std::uint8_t marker = reader.ReadByte();
+        if (marker < kFixMap)       return array.AppendInt(marker);
+        if (marker >= kNegFixInt)   return array.AppendInt(ToSigned<std::int8_t>(marker));
+
+        switch (marker)
+        {
+            case kFloat32:
+            {
+                auto bits = static_cast<std::uint32_t>(reader.ReadBigEndian(4));
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return array.AppendReal(value);
+            }
+            case kFloat64:
+            {
+                std::uint64_t bits = reader.ReadBigEndian(8);
+                double value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return array.AppendReal(value);
+            }
+            case kUint8:    return array.AppendInt(static_cast<Int::ValueType>(reader.ReadBigEndian(1)));
+            case kUint16:   return array.AppendInt(static_cast<Int::ValueType>(reader.ReadBigEndian(2)));
+            case kUint32:   return array.AppendInt(static_cast<Int::ValueType>(reader.ReadBigEndian(4)));
+            case kUint64:
+            {
+                std::uint64_t value = reader.ReadBigEndian(8);
+                if (value > static_cast<std::uint64_t>(std::numeric_limits<Int::ValueType>::max()))
+                {
+                    return array.AppendReal(static_cast<Real::ValueType>(value));
+                }
+                return array.AppendInt(static_cast<Int::ValueType>(value));
+            }
+            case kInt8:     return array.AppendInt(ToSigned<std::int8_t>(reader.ReadBigEndian(1)));
+            case kInt16:    return array.AppendInt(ToSigned<std::int16_t>(reader.ReadBigEndian(2)));
+            case kInt32:    return array.AppendInt(ToSigned<std::int32_t>(reader.ReadBigEndian(4)));
+            case kInt64:    return array.AppendInt(ToSigned<std::int64_t>(reader.ReadBigEndian(8)));
+            default:        return array.Append(ParseValue(reader, marker, depth));
+        }
+    }
+
+    Pointer<Object> MsgPackSerializer::ParseObject(Reader &reader, std::uint64_t size, std::size_t depth)
+    {
+        if (depth >= kMaxDepth) throw std::invalid_argument("msgpack: containers nested too deeply");
+
+        auto object = Object::Make();
+        for (std::uint64_t i = 0; i < size; i++) object->Insert(ParseField(reader, depth + 1));
+
+        return object;
+    }
+
+    Pointer<Object> MsgPackSerializer::ParseObject(Reader &reader)
+    {
+        std::uint8_t marker = reader.ReadByte();
+
+        if ((marker & 0xF0) == kFixMap)  return ParseObject(reader, marker & 0x0F, 0);
+        if (marker == kMap16)            return ParseObject(reader, reader.ReadBigEndian(2), 0);
+        if (marker == kMap32)            return ParseObject(reader, reader.ReadBigEndian(4), 0);
+
+        throw std::invalid_argument("msgpack: expected a map");
+    }
+
+    Pointer<Field> MsgPackSerializer::ParseField(Reader &reader, std::size_t depth)
+    {
+        std::uint8_t marker = reader.ReadByte();
+
+        std::uint64_t size;
+        if ((marker & 0xE0) == kFixStr)                 size = marker & 0x1F;
+        else if (marker == kStr8 || marker == kBin8)    size = reader.ReadBigEndian(1);
+        else if (marker == kStr16 || marker == kBin16)  size = reader.ReadBigEndian(2);
+        else if (marker == kStr32 || marker == kBin32)  size = reader.ReadBigEndian(4);
+        else throw std::invalid_argument("msgpack: map keys must be strings");
+
+        StringView name = reader.ReadBytes(static_cast<std::size_t>(size));
+        if (reader.GetSource()) return Field::Make(reader.GetSource(), name, ParseValue(reader, depth));
+
+        // The name must be copied before ParseValue() refills the reader's window.
+        ara::rest::String copy(name);
+        return Field::Make(SharedBuffer(), copy, ParseValue(reader, depth));
+    }
+
+    MsgPackSerializer::Reader::Reader(StringView buffer, const SharedBuffer &source) : window_(buffer), source_(source)
+    {
+    }
+
+    MsgPackSerializer::Reader::Reader(std::istream &stream) : stream_(&stream)
+    {
+    }
+
+    std::uint8_t MsgPackSerializer::Reader::ReadByte()
+    {
+        Fill(1);
+
+        auto byte = static_cast<std::uint8_t>(window_.front());
+        window_.remove_prefix(1);
+
+        return byte;
+    }
+
+    std::uint64_t MsgPackSerializer::Reader::ReadBigEndian(std::size_t size)
+    {
+        std::uint64_t value = 0;
+        for (char c : ReadBytes(size)) value = (value << 8) | static_cast<std::uint8_t>(c);
+
+        return value;
+    }
+
+    StringView MsgPackSerializer::Reader::ReadBytes(std::size_t size)
+    {
+        Fill(size);
+
+        StringView bytes = window_.substr(0, size);
+        window_.remove_prefix(size);
+
+        return bytes;
+    }
+
+    void MsgPackSerializer::Reader::Fill(std::size_t size)
+    {
+        if (window_.size() >= size) return;
+        if (!stream_) throw std::invalid_argument("msgpack: unexpected end of input");
+
+        // Keep the unread tail, then pull chunks until the request is covered. Growth is bounded by what the
+        // stream actually delivers, not by a length prefix.
+        staging_.erase(0, staging_.size() - window_.size());
+        while (staging_.size() < size && *stream_)
+        {
+            std::size_t available = staging_.size();
+            staging_.resize(available + kChunkSize);
+            stream_->read(&staging_[available], static_cast<std::streamsize>(kChunkSize));
+            staging_.resize(available + static_cast<std::size_t>(stream_->gcount()));
+        }
+        window_ = staging_;
+
+        if (window_.size() < size) throw std::invalid_argument("msgpack: unexpected end of input");
+    }
+
+    void MsgPackStructWriter::WriteInt(std::int64_t value)
+    {
+        MsgPackSerializer::WriteInt(value, sink_);
+    }
+
+    void MsgPackStructWriter::WriteReal(long double value)
+    {
+        MsgPackSerializer::WriteReal(value, sink_);
+    }
+
+    void MsgPackStructWriter::WriteBool(bool value)
+    {
+        sink_.Append(static_cast<char>(value ? kTrue : kFalse));
+    }
+
+    void MsgPackStructWriter::WriteString(StringView value)
+    {
+        MsgPackSerializer::WriteText(value, sink_);
+    }
+
+    void MsgPackStructWriter::BeginObject(std::size_t size)
+    {
+        MsgPackSerializer::WriteHead(kFixMap, 16, kMap16, size, sink_);
+    }
+
+    void MsgPackStructWriter::WriteKey(StringView name, std::size_t)
+    {
+        MsgPackSerializer::WriteText(name, sink_);
+    }
+
+    void MsgPackStructWriter::BeginArray(std::size_t size)
+    {
+        MsgPackSerializer::WriteHead(kFixArray, 16, kArray16, size, sink_);
+    }
+
+    std::int64_t MsgPackStructReader::ReadInt()
+    {
+        std::uint8_t marker = reader_.ReadByte();
+
+        if (marker < kFixMap)       return marker;
+        if (marker >= kNegFixInt)   return ToSigned<std::int8_t>(marker);
+
+        switch (marker)
+        {
+            case kUint8:    return static_cast<std::int64_t>(reader_.ReadBigEndian(1));
+            case kUint16:   return static_cast<std::int64_t>(reader_.ReadBigEndian(2));
+            case kUint32:   return static_cast<std::int64_t>(reader_.ReadBigEndian(4));
+            case kUint64:
+            {
+                std::uint64_t value = reader_.ReadBigEndian(8);
+                if (value > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())) break;
+                return static_cast<std::int64_t>(value);
+            }
+            case kInt8:     return ToSigned<std::int8_t>(reader_.ReadBigEndian(1));
+            case kInt16:    return ToSigned<std::int16_t>(reader_.ReadBigEndian(2));
+            case kInt32:    return ToSigned<std::int32_t>(reader_.ReadBigEndian(4));
+            case kInt64:    return ToSigned<std::int64_t>(reader_.ReadBigEndian(8));
+            default:        break;
+        }
+
+        throw std::invalid_argument("msgpack: expected an integer");
+    }
+
+    long double MsgPackStructReader::ReadReal()
+    {
+        MsgPackSerializer parser;
+        auto value = parser.ParseValue(reader_, 0);
+
+        if (value->IsInt()) return static_cast<Int&>(*value).GetValue();
+        if (value->IsReal()) return static_cast<Real&>(*value).GetValue();
+
+        throw std::invalid_argument("msgpack: expected a number");
+    }
+
+    bool MsgPackStructReader::ReadBool()
+    {
+        std::uint8_t marker = reader_.ReadByte();
+        if (marker == kTrue || marker == kFalse) return marker == kTrue;
+
+        throw std::invalid_argument("msgpack: expected a boolean");
+    }
+
+    void MsgPackStructReader::ReadString(ara::rest::String &value)
+    {
+        StringView bytes = reader_.ReadBytes(ReadStringSize(reader_.ReadByte()));
+        value.assign(bytes.data(), bytes.size());
+    }
+
+    std::size_t MsgPackStructReader::BeginObject()
+    {
+        std::uint8_t marker = reader_.ReadByte();
+
+        if ((marker & 0xF0) == kFixMap)  return marker & 0x0F;
+        if (marker == kMap16)            return static_cast<std::size_t>(reader_.ReadBigEndian(2));
+        if (marker == kMap32)            return static_cast<std::size_t>(reader_.ReadBigEndian(4));
+
+        throw std::invalid_argument("msgpack: expected a map");
+    }
+
+    bool MsgPackStructReader::NextKey(std::size_t size, std::size_t index, StringView &name)
+    {
+        if (index >= size) return false;
+
+        name = reader_.ReadBytes(ReadStringSize(reader_.ReadByte()));
+        return true;
+    }
+
+    std::size_t MsgPackStructReader::BeginArray()
+    {
+        std::uint8_t marker = reader_.ReadByte();
+
+        if ((marker & 0xF0) == kFixArray)  return marker & 0x0F;
+        if (marker == kArray16)            return static_cast<std::size_t>(reader_.ReadBigEndian(2));
+        if (marker == kArray32)            return static_cast<std::size_t>(reader_.ReadBigEndian(4));
+
+        throw std::invalid_argument("msgpack: expected an array");
+    }
+
+    void MsgPackStructReader::Skip()
+    {
+        MsgPackSerializer parser;
+        parser.ParseValue(reader_, 0);
+    }
+
+    std::size_t MsgPackStructReader::ReadStringSize(std::uint8_t marker)
+    {
+        if ((marker & 0xE0) == kFixStr)                 return marker & 0x1F;
+        if (marker == kStr8 || marker == kBin8)         return static_cast<std::size_t>(reader_.ReadBigEndian(1));
+        if (marker == kStr16 || marker == kBin16)       return static_cast<std::size_t>(reader_.ReadBigEndian(2));
+        if (marker == kStr32 || marker == kBin32)       return static_cast<std::size_t>(reader_.ReadBigEndian(4));
+
+        throw std::invalid_argument("msgpack: expected a string");
+    }
+
+}
+}
+}
@@ -0,0 +1,49 @@
+#include <ara/rest/ogm/serializer/parse_error.h>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        class ParseErrorCategory : public std::error_category
+        {
+        public:
+            const char *name() const noexcept override
+            {
+                return "ogm-parse";
+            }
+
+            std::string message(int condition) const override
+            {
+                switch (static_cast<ParseError>(condition))
+                {
+                    case ParseError::kUnexpectedEnd:        return "unexpected end of input";
+                    case ParseError::kUnexpectedToken:      return "unexpected token";
+                    case ParseError::kMalformedNumber:      return "malformed number";
+                    case ParseError::kNumberOutOfRange:     return "number out of range";
+                    case ParseError::kUnterminatedString:   return "unterminated string";
+                    case ParseError::kInvalidEscape:        return "invalid escape sequence";
+                    case ParseError::kMalformedStructure:   return "malformed structure";
+                    case ParseError::kTypeMismatch:         return "unexpected value type";
+                    case ParseError::kMalformedInput:       return "malformed input";
+                    case ParseError::kDocumentTooLarge:     return "document too large";
+                    case ParseError::kNestingTooDeep:       return "containers nested too deeply";
+                }
+                return "unknown parse error";
+            }
+        };
+    }
+
+    const std::error_category &GetParseErrorCategory() noexcept
+    {
+        static const ParseErrorCategory category;
+        return category;
+    }
+
+}
+}
+}
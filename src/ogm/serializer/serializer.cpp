@@ -1,5 +1,12 @@
 #include <ara/rest/ogm/serializer/serializer.h>
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
 #include <ara/rest/ogm/value.h>
 #include <ara/rest/ogm/int.h>
 #include <ara/rest/ogm/real.h>
@@ -7,6 +14,9 @@
 #include <ara/rest/ogm/array.h>
 #include <ara/rest/ogm/object.h>
 #include <ara/rest/ogm/field.h>
+#include <ara/rest/ogm/projection.h>
+#include <ara/rest/ogm/serializer/serializer_registry.h>
+#include <ara/rest/ogm/serializer/worker_pool.h>
 
 namespace ara
 {
@@ -15,28 +25,275 @@ namespace rest
 namespace ogm
 {
 
-    ara::rest::String Serializer::Serialize(ogm::Node *node)
+    namespace
     {
-        static auto serializer = SerializerFactory::CreateSerializer("application/json");
+        /**
+         * A shard is only split off for at least this many children, so that a container with a few large
+         * children leaves the decision to them.
+         */
+        constexpr std::size_t kMinChildrenPerShard = 16;
+
+        std::atomic<std::size_t> parallelThreshold{ Serializer::kDefaultParallelThreshold };
+
+        /**
+         * Set while the current thread serializes a subtree that must not be split further: either a shard,
+         * or a container already known to be below the threshold.
+         */
+        thread_local bool sequential = false;
+
+        class SequentialScope
+        {
+        public:
+            SequentialScope() : previous_(sequential) { sequential = true; }
+            ~SequentialScope() { sequential = previous_; }
+
+        private:
+            bool previous_;
+        };
 
+        /**
+         * Counts the nodes of a subtree, stopping once limit is reached.
+         */
+        std::size_t CountNodes(const Value &value, std::size_t limit)
+        {
+            std::size_t count = 1;
+            if (value.IsArray() && static_cast<const Array&>(value).IsPacked())
+            {
+                count += static_cast<const Array&>(value).GetSize();
+            }
+            else if (value.IsArray())
+            {
+                auto values = static_cast<const Array&>(value).GetValues();
+                for (auto it = values.Begin(); it != values.End() && count < limit; ++it)
+                {
+                    count += CountNodes(**it, limit - count);
+                }
+            }
+            else if (value.IsObject())
+            {
+                auto fields = static_cast<const Object&>(value).GetFields();
+                for (auto it = fields.Begin(); it != fields.End() && count < limit; ++it)
+                {
+                    count += CountNodes((*it)->GetValue(), limit - count);
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * Runs the throwing parser of a codec and reports any exception it throws through error instead.
+         * Allocation failures caused by the input are reported as kDocumentTooLarge, everything else as
+         * kMalformedInput.
+         */
+        template <typename Parse>
+        Pointer<Object> Contain(Parse &&parse, ErrorCode &error)
+        {
+            try
+            {
+                return parse();
+            }
+            catch (const std::bad_alloc &)
+            {
+                error = ParseError::kDocumentTooLarge;
+            }
+            catch (const std::length_error &)
+            {
+                error = ParseError::kDocumentTooLarge;
+            }
+            catch (...)
+            {
+                error = ParseError::kMalformedInput;
+            }
+
+            return nullptr;
+        }
+    }
+
+    ara::rest::String Serializer::Serialize(ogm::Node *node)
+    {
         ara::rest::String serializedString;
-        if (node->IsInt())          serializedString = serializer->Serialize(dynamic_cast<Int&>(*node));
-        else if (node->IsReal())    serializedString = serializer->Serialize(dynamic_cast<Real&>(*node));
-        else if (node->IsString())  serializedString = serializer->Serialize(dynamic_cast<String&>(*node));
-        else if (node->IsArray())   serializedString = serializer->Serialize(dynamic_cast<Array&>(*node));
-        else if (node->IsObject())  serializedString = serializer->Serialize(dynamic_cast<Object&>(*node));
-        else if (node->IsField())   serializedString = serializer->Serialize(dynamic_cast<Field&>(*node));
+        OutputSink sink(serializedString);
+        Serialize(node, sink);
 
         return serializedString;
     }
 
+    void Serializer::Serialize(ogm::Node *node, OutputSink &sink)
+    {
+        Serialize(node, sink, "application/json");
+    }
+
+    void Serializer::Serialize(ogm::Node *node, OutputSink &sink, StringView contentType)
+    {
+        auto serializer = &GetSerializer(contentType);
+
+        if (node->IsInt())          serializer->Serialize(static_cast<Int&>(*node), sink);
+        else if (node->IsReal())    serializer->Serialize(static_cast<Real&>(*node), sink);
+        else if (node->IsString())  serializer->Serialize(static_cast<String&>(*node), sink);
+        else if (node->IsArray())   serializer->Serialize(static_cast<Array&>(*node), sink);
+        else if (node->IsObject())  serializer->Serialize(static_cast<Object&>(*node), sink);
+        else if (node->IsField())   serializer->Serialize(static_cast<Field&>(*node), sink);
+    }
+
+    void Serializer::Serialize(ogm::Object *object, OutputSink &sink, StringView contentType, const Projection &projection)
+    {
+        GetSerializer(contentType).Serialize(*object, projection.GetRoot(), sink);
+    }
+
+    void Serializer::SetParallelThreshold(std::size_t nodes) noexcept
+    {
+        parallelThreshold = nodes;
+    }
+
+    std::size_t Serializer::GetParallelThreshold() noexcept
+    {
+        return parallelThreshold;
+    }
+
+    void Serializer::SerializeChildren(const Value &container, std::size_t count, OutputSink &sink,
+                                       const Function<void(std::size_t, OutputSink&)> &write)
+    {
+        std::size_t threshold = parallelThreshold;
+        if (sequential || threshold == 0)
+        {
+            for (std::size_t index = 0; index < count; index++) write(index, sink);
+            return;
+        }
+
+        // A container too narrow to shard is not counted; the first wide container below it decides instead.
+        // Counting stops there either way, so every node is counted at most once.
+        WorkerPool &pool = WorkerPool::GetInstance();
+        std::size_t shards = std::min<std::size_t>(pool.GetConcurrency(), count / kMinChildrenPerShard);
+        if (shards < 2)
+        {
+            for (std::size_t index = 0; index < count; index++) write(index, sink);
+            return;
+        }
+
+        if (CountNodes(container, threshold) < threshold)
+        {
+            SequentialScope scope;
+            for (std::size_t index = 0; index < count; index++) write(index, sink);
+            return;
+        }
+
+        std::size_t perShard = (count + shards - 1) / shards;
+        auto writeShard = [&write, count, perShard](std::size_t shard, ara::rest::String &buffer)
+        {
+            SequentialScope scope;
+            OutputSink shardSink(buffer);
+            std::size_t last = std::min(count, (shard + 1) * perShard);
+            for (std::size_t index = shard * perShard; index < last; index++) write(index, shardSink);
+        };
+
+        std::vector<ara::rest::String> buffers(shards);
+        pool.Run(shards, [&writeShard, &buffers](std::size_t shard) { writeShard(shard, buffers[shard]); });
+
+        for (auto &buffer : buffers) sink.Splice(std::move(buffer));
+    }
+
     Pointer<Object> Serializer::Deserialize(const ara::rest::String &binary)
     {
-        ara::rest::String dump(binary);
-        dump.erase(remove_if(dump.begin(), dump.end(), [](auto &c) { return isspace(c) && c != ' ';} ), dump.end());
-        static auto deserializer = SerializerFactory::CreateSerializer("application/json");
+        return Deserialize(binary, "application/json");
+    }
+
+    Pointer<Object> Serializer::Deserialize(const ara::rest::String &binary, StringView contentType)
+    {
+        return GetSerializer(contentType).DeserializeToObject(binary);
+    }
+
+    Pointer<Array> Serializer::DeserializeArray(const ara::rest::String &binary, StringView contentType)
+    {
+        return GetSerializer(contentType).DeserializeToArray(binary);
+    }
+
+    Pointer<Object> Serializer::Deserialize(const SharedBuffer &buffer)
+    {
+        return GetSerializer("application/json").DeserializeToObject(buffer);
+    }
+
+    Pointer<Object> Serializer::Deserialize(std::istream &stream, StringView contentType)
+    {
+        return GetSerializer(contentType).DeserializeToObject(stream);
+    }
+
+    Pointer<Object> Serializer::Deserialize(const ara::rest::String &binary, StringView contentType, ErrorCode &error)
+    {
+        error.clear();
+        return GetSerializer(contentType).DeserializeToObject(binary, error);
+    }
+
+    Pointer<Object> Serializer::Deserialize(const SharedBuffer &buffer, ErrorCode &error)
+    {
+        error.clear();
+        return GetSerializer("application/json").DeserializeToObject(buffer, error);
+    }
+
+    Pointer<Object> Serializer::Deserialize(std::istream &stream, StringView contentType, ErrorCode &error)
+    {
+        error.clear();
+        return GetSerializer(contentType).DeserializeToObject(stream, error);
+    }
+
+    Pointer<Object> Serializer::Deserialize(const ara::rest::String &binary, StringView contentType, const Projection &projection)
+    {
+        return GetSerializer(contentType).DeserializeToObject(binary, projection);
+    }
+
+    Pointer<Object> Serializer::Deserialize(std::istream &stream, StringView contentType, const Projection &projection)
+    {
+        return GetSerializer(contentType).DeserializeToObject(stream, projection);
+    }
+
+    Serializer &Serializer::GetSerializer(StringView contentType)
+    {
+        return SerializerRegistry::GetInstance().Get(contentType);
+    }
+
+    Pointer<Object> Serializer::DeserializeToObject(const SharedBuffer &binary)
+    {
+        return DeserializeToObject(*binary);
+    }
+
+    Pointer<Object> Serializer::DeserializeToObject(std::istream &stream)
+    {
+        ara::rest::String binary{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+        return DeserializeToObject(binary);
+    }
+
+    /**
+     * Codecs without an exception-free parser report failures of their throwing parser through error (see Contain).
+     */
+    Pointer<Object> Serializer::DeserializeToObject(const ara::rest::String &binary, ErrorCode &error)
+    {
+        return Contain([&] { return DeserializeToObject(binary); }, error);
+    }
+
+    Pointer<Object> Serializer::DeserializeToObject(const SharedBuffer &binary, ErrorCode &error)
+    {
+        return DeserializeToObject(*binary, error);
+    }
+
+    Pointer<Object> Serializer::DeserializeToObject(std::istream &stream, ErrorCode &error)
+    {
+        return Contain([&] { return DeserializeToObject(stream); }, error);
+    }
+
+    Pointer<Object> Serializer::DeserializeToObject(const ara::rest::String &binary, const Projection &projection)
+    {
+        auto object = DeserializeToObject(binary);
+        projection.Apply(*object);
+
+        return object;
+    }
+
+    Pointer<Object> Serializer::DeserializeToObject(std::istream &stream, const Projection &projection)
+    {
+        auto object = DeserializeToObject(stream);
+        projection.Apply(*object);
 
-        return deserializer->DeserializeToObject(dump);
+        return object;
     }
 
 }
@@ -0,0 +1,157 @@
+#include <ara/rest/ogm/serializer/serializer_registry.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <mutex>
+#include <stdexcept>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    namespace
+    {
+        StringView Trim(StringView text)
+        {
+            auto first = text.find_first_not_of(" \t");
+            if (first == StringView::npos) return StringView();
+            auto last = text.find_last_not_of(" \t");
+
+            return text.substr(first, last - first + 1);
+        }
+
+        /**
+         * Media types and parameter names are case-insensitive (RFC 9110, 8.3.1).
+         */
+        bool EqualsIgnoreCase(StringView a, StringView b)
+        {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y)
+            {
+                return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+            });
+        }
+
+        /**
+         * Returns the weight of one media range of an Accept header: the value of its "q" parameter, 1 if it has
+         * none. Other parameters are ignored.
+         */
+        double GetQuality(StringView range)
+        {
+            double quality = 1.0;
+
+            std::size_t end = range.find(';');
+            while (end != StringView::npos)
+            {
+                range.remove_prefix(end + 1);
+                end = range.find(';');
+                StringView parameter = range.substr(0, end);
+
+                std::size_t equals = parameter.find('=');
+                if (equals == StringView::npos || !EqualsIgnoreCase(Trim(parameter.substr(0, equals)), "q")) continue;
+
+                StringView weight = Trim(parameter.substr(equals + 1));
+                if (std::from_chars(weight.data(), weight.data() + weight.size(), quality).ec != std::errc()) quality = 0.0;
+            }
+
+            return quality;
+        }
+    }
+
+    SerializerRegistry &SerializerRegistry::GetInstance()
+    {
+        static SerializerRegistry registry;
+        return registry;
+    }
+
+    SerializerRegistry::SerializerRegistry()
+    {
+        entries_.push_back(Entry{ "application/json", Pointer<Serializer>(new JsonSerializer()) });
+        entries_.push_back(Entry{ "application/cbor", Pointer<Serializer>(new CborSerializer()) });
+        entries_.push_back(Entry{ "application/msgpack", Pointer<Serializer>(new MsgPackSerializer()) });
+    }
+
+    bool SerializerRegistry::Register(StringView mediaType, Pointer<Serializer> &&codec)
+    {
+        if (!codec) throw std::invalid_argument("serializer registry: codec is null");
+
+        mediaType = GetMediaType(mediaType);
+        if (mediaType.empty()) throw std::invalid_argument("serializer registry: media type is empty");
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (FindEntry(mediaType)) return false;
+
+        entries_.push_back(Entry{ ara::rest::String(mediaType), std::move(codec) });
+        return true;
+    }
+
+    Serializer *SerializerRegistry::Find(StringView contentType) const
+    {
+        StringView mediaType = GetMediaType(contentType);
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const Entry *entry = FindEntry(mediaType);
+
+        return entry ? entry->codec.get() : nullptr;
+    }
+
+    Serializer &SerializerRegistry::Get(StringView contentType) const
+    {
+        StringView mediaType = GetMediaType(contentType);
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const Entry *entry = FindEntry(mediaType);
+
+        return *(entry ? entry : &entries_.front())->codec;
+    }
+
+    StringView SerializerRegistry::Negotiate(StringView accept) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        const Entry *best = &entries_.front();
+        double bestQuality = 0.0;
+
+        while (!accept.empty())
+        {
+            std::size_t end = accept.find(',');
+            StringView range = accept.substr(0, end);
+            accept.remove_prefix(end == StringView::npos ? accept.size() : end + 1);
+
+            double quality = GetQuality(range);
+
+            StringView mediaType = GetMediaType(range);
+            bool wildcard = EqualsIgnoreCase(mediaType, "*/*") || EqualsIgnoreCase(mediaType, "application/*");
+            const Entry *entry = wildcard ? &entries_.front() : FindEntry(mediaType);
+
+            if (entry && quality > bestQuality)
+            {
+                best = entry;
+                bestQuality = quality;
+            }
+        }
+
+        return best->mediaType;
+    }
+
+    StringView SerializerRegistry::GetMediaType(StringView contentType)
+    {
+        return Trim(contentType.substr(0, contentType.find(';')));
+    }
+
+    const SerializerRegistry::Entry *SerializerRegistry::FindEntry(StringView mediaType) const
+    {
+        for (const auto &entry : entries_)
+        {
+            if (EqualsIgnoreCase(entry.mediaType, mediaType)) return &entry;
+        }
+
+        return nullptr;
+    }
+
+}
+}
+}
@@ -0,0 +1,133 @@
+#include <ara/rest/ogm/serializer/worker_pool.h>
+
+#include <atomic>
+#include <exception>
+
+namespace ara
+{
+namespace rest
+{
+namespace ogm
+{
+
+    /**
+     * The tasks of one Run call. Any thread claims the next task through next, so a batch is finished by
+     * whichever threads get to it first.
+     */
+    struct WorkerPool::Batch
+    {
+        Batch(std::size_t count, const Function<void(std::size_t)> &task) : count(count), task(task) {}
+
+        /**
+         * Runs one unclaimed task. Returns false if every task has already been claimed.
+         */
+        bool RunOne()
+        {
+            std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= count) return false;
+
+            std::exception_ptr thrown;
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                thrown = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (thrown && !failure) failure = thrown;
+            if (++finished == count) done.notify_all();
+
+            return true;
+        }
+
+        const std::size_t count;
+        const Function<void(std::size_t)> &task;
+        std::atomic<std::size_t> next{ 0 };
+
+        std::mutex mutex;
+        std::condition_variable done;
+        std::size_t finished = 0;
+        std::exception_ptr failure;
+    };
+
+    WorkerPool &WorkerPool::GetInstance()
+    {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    WorkerPool::WorkerPool()
+    {
+        unsigned threads = std::thread::hardware_concurrency();
+        for (unsigned i = 1; i < threads; i++) workers_.emplace_back(&WorkerPool::Work, this);
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+
+        for (auto &worker : workers_) worker.join();
+    }
+
+    void WorkerPool::Run(std::size_t count, const Function<void(std::size_t)> &task)
+    {
+        if (count == 0) return;
+        if (count == 1 || workers_.empty())
+        {
+            for (std::size_t index = 0; index < count; index++) task(index);
+            return;
+        }
+
+        auto batch = std::make_shared<Batch>(count, task);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(batch);
+        }
+        if (count - 1 < workers_.size()) for (std::size_t i = 1; i < count; i++) wake_.notify_one();
+        else wake_.notify_all();
+
+        while (batch->RunOne()) {}
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto it = queue_.begin(); it != queue_.end(); ++it)
+            {
+                if (*it != batch) continue;
+                queue_.erase(it);
+                break;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(batch->mutex);
+        batch->done.wait(lock, [&batch] { return batch->finished == batch->count; });
+        if (batch->failure) std::rethrow_exception(batch->failure);
+    }
+
+    void WorkerPool::Work()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+        {
+            wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) return;
+
+            std::shared_ptr<Batch> batch = queue_.front();
+            lock.unlock();
+            bool ran = batch->RunOne();
+            lock.lock();
+
+            // A batch leaves the queue once all of its tasks are claimed; its caller waits for the rest.
+            if (!ran && !queue_.empty() && queue_.front() == batch) queue_.pop_front();
+        }
+    }
+
+}
+}
+}
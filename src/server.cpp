@@ -1,4 +1,9 @@
 #include <ara/rest/server.h>
+
+#include <iterator>
+
+#include <ara/rest/ogm/serializer/parse_error.h>
+#include <ara/rest/ogm/serializer/serializer.h>
 #include "../include/internal/ara/rest/server_http_binder.h"
 
 namespace ara
@@ -47,6 +52,10 @@ namespace rest
 
     /**
      * ara::rest::ServerRequest Constructors
+     *
+     * Payloads this request builds by parsing its document are allocated from its own arena and freed together
+     * with it. A copied payload shares its contents with the original until either is modified, so copying
+     * allocates a single node and needs no arena.
      */
     ServerRequest::ServerRequest(RequestMethod method, const Uri &uri, const Pointer <ogm::Object> &payload)
             : header_(method, uri), payload_(ogm::Copy(payload))
@@ -54,6 +63,34 @@ namespace rest
 
     }
 
+    ServerRequest::ServerRequest(RequestMethod method, const Uri &uri, Pointer<ogm::Object> &&payload)
+            : header_(method, uri), payload_(std::move(payload))
+    {
+
+    }
+
+    ServerRequest::ServerRequest(RequestMethod method, const Uri &uri, String &&binary)
+            : header_(method, uri)
+    {
+        if (binary.empty()) return;
+
+        arena_ = std::make_unique<ogm::Arena>();
+        document_ = std::make_unique<ogm::JsonDocument>(std::move(binary));
+    }
+
+    ServerRequest::ServerRequest(RequestMethod method, const Uri &uri, Pointer<ogm::Arena> &&arena,
+                                 Pointer<ogm::Object> &&payload)
+            : header_(method, uri), arena_(std::move(arena)), payload_(std::move(payload))
+    {
+
+    }
+
+    ServerRequest::ServerRequest(RequestMethod method, const Uri &uri, std::istream &stream, StringView contentType)
+            : header_(method, uri), arena_(std::make_unique<ogm::Arena>()), stream_(&stream), contentType_(contentType)
+    {
+
+    }
+
     /**
      * ara::rest::ServerRequest Member Functions
      */
@@ -64,9 +101,130 @@ namespace rest
 
     const ogm::Object &ServerRequest::GetObject() const
     {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return GetPayload();
+    }
+
+    /**
+     * A JSON body still in the stream is read into the document instead of being parsed and serialized again.
+     * Any other payload is serialized once; the document is kept for later views and for ReleaseBinary().
+     */
+    ogm::JsonView ServerRequest::GetView() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!document_ && !payload_ && stream_ && contentType_ == "application/json")
+        {
+            std::istream &stream = *stream_;
+            stream_ = nullptr;
+            document_ = std::make_unique<ogm::JsonDocument>(String(std::istreambuf_iterator<char>(stream),
+                                                                   std::istreambuf_iterator<char>()));
+        }
+        if (!document_) document_ = std::make_unique<ogm::JsonDocument>(GetPayload().Serialize());
+        if (!error_) error_ = document_->GetError();
+
+        return document_->GetRoot();
+    }
+
+    Task<Pointer<ogm::Object>> ServerRequest::ReleaseObject()
+    {
+        std::promise<Pointer<ogm::Object>> released;
+        try
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            GetPayload();
+            released.set_value(std::move(payload_));
+        }
+        catch (...)
+        {
+            released.set_exception(std::current_exception());
+        }
+
+        return released.get_future();
+    }
+
+    Task<Pointer<ogm::Object>> ServerRequest::ReleaseObject(const ogm::Projection &projection)
+    {
+        std::promise<Pointer<ogm::Object>> released;
+        try
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!payload_ && (stream_ || document_))
+            {
+                released.set_value(Parse(&projection));
+                return released.get_future();
+            }
+
+            if (!payload_) payload_ = ogm::Object::Make();
+
+            projection.Apply(*payload_);
+            released.set_value(std::move(payload_));
+        }
+        catch (...)
+        {
+            released.set_exception(std::current_exception());
+        }
+
+        return released.get_future();
+    }
+
+    Task<Pointer<String>> ServerRequest::ReleaseBinary()
+    {
+        std::promise<Pointer<String>> released;
+        try
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (document_) released.set_value(std::make_unique<String>(document_->GetBinary()));
+            else released.set_value(std::make_unique<String>(GetPayload().Serialize()));
+        }
+        catch (...)
+        {
+            released.set_exception(std::current_exception());
+        }
+
+        return released.get_future();
+    }
+
+    ErrorCode ServerRequest::GetError() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return error_;
+    }
+
+    /**
+     * Parses the payload on first access. The caller holds mutex_.
+     */
+    const ogm::Object &ServerRequest::GetPayload() const
+    {
+        if (!payload_ && (stream_ || document_)) payload_ = Parse(nullptr);
+        if (!payload_) payload_ = ogm::Object::Make();
+
         return *payload_;
     }
 
+    /**
+     * Parses the pending payload inside the request's arena. A payload still in the stream is decoded as it is
+     * read, so a projection skips unselected JSON subtrees without buffering the body. A malformed payload is
+     * recorded for GetError() and reported as std::invalid_argument.
+     */
+    Pointer<ogm::Object> ServerRequest::Parse(const ogm::Projection *projection) const
+    {
+        ogm::Arena::Scope scope(*arena_);
+        try
+        {
+            if (!stream_) return projection ? document_->Materialize(*projection) : document_->Materialize();
+
+            std::istream &stream = *stream_;
+            stream_ = nullptr;
+            return projection ? ogm::Serializer::Deserialize(stream, contentType_, *projection)
+                              : ogm::Serializer::Deserialize(stream, contentType_);
+        }
+        catch (const std::invalid_argument &)
+        {
+            error_ = ogm::ParseError::kMalformedInput;
+            throw;
+        }
+    }
+
     /**
      * ara::rest::ServerReply Constructors
      */
@@ -76,6 +234,12 @@ namespace rest
 
     }
 
+    ServerReply::ServerReply(const Uri &uri, StatusCode status, Pointer<ogm::Object> &&payload)
+            : header_(uri, status), payload_(std::move(payload))
+    {
+
+    }
+
     /**
      * ara::rest::ServerReply Member Functions
      */
@@ -2,6 +2,8 @@
 
 #include <iostream>
 
+#include <ara/rest/ogm/hash.h>
+
 namespace ara
 {
 namespace rest
@@ -67,34 +69,251 @@ namespace rest
 
     void ServerHttpRequestHandler::handleRequest(HTTPServerRequest &request, HTTPServerResponse &response)
     {
+        // A body no registered codec can decode is refused before it is read. A body without a Content-Type
+        // is still taken as JSON.
+        String contentType = request.getContentType();
+        if (!contentType.empty() && request.getContentLength() != 0
+            && !ogm::SerializerRegistry::GetInstance().Find(contentType))
+        {
+            response.setStatus(HTTPResponse::HTTP_UNSUPPORTED_MEDIA_TYPE);
+            response.setContentLength(0);
+            response.send().flush();
+            return;
+        }
+
         auto uri = Uri::Builder("http://" + request.getHost() + request.getURI()).ToUri();
-        handler_(ServerHttpRequest::MakeFrom(&request, uri), ServerHttpReply::MakeFrom(&response, uri));
+
+        auto serverRequest = ServerHttpRequest::MakeFrom(&request, uri);
+        bool safe = request.getMethod() == HTTPRequest::HTTP_GET || request.getMethod() == HTTPRequest::HTTP_HEAD;
+        auto serverReply = ServerHttpReply::MakeFrom(&response, uri, request.get("Accept", ""), safe,
+                                                     safe ? request.get("If-None-Match", "") : String());
+
+        try
+        {
+            handler_(*serverRequest, *serverReply);
+        }
+        catch (const std::invalid_argument &)
+        {
+            // A malformed body is only found when the handler first reads the payload.
+            if (!serverRequest->GetError() || response.sent()) throw;
+
+            response.setStatus(HTTPResponse::HTTP_BAD_REQUEST);
+            response.setContentLength(0);
+            response.send().flush();
+        }
+    }
+
+    RequestMethod ServerHttpRequest::ConvertMethod(const std::string &method)
+    {
+        if (method == HTTPRequest::HTTP_POST)           return RequestMethod::kPost;
+        else if (method == HTTPRequest::HTTP_PUT)       return RequestMethod::kPut;
+        else if (method == HTTPRequest::HTTP_DELETE)    return RequestMethod::kDelete;
+        else if (method == HTTPRequest::HTTP_OPTIONS)   return RequestMethod::kOptions;
+        else if (method == HTTPRequest::HTTP_HEAD)      return RequestMethod::kHead;
+        else                                            return RequestMethod::kGet;
     }
 
     Task<void> ServerHttpReply::Send(const Pointer<ara::rest::ogm::Object> &data)
     {
-        return Send(data->Serialize());
+        if (ogm::SerializerRegistry::GetInstance().Get(contentType_).IsStreaming()) return SendStreamed(data);
+
+        String etag;
+        if (IsTagged())
+        {
+            etag = MakeETag(*data);
+            if (MatchesETag(ifNoneMatch_, etag)) return SendNotModified(etag);
+        }
+
+        String body;
+        ogm::OutputSink sink(body);
+        Serialize(data.get(), sink, !etag.empty());
+
+        pocoReply_->set("Vary", "Accept");
+        return SendBody(std::move(body), contentType_, etag);
     }
 
+    /**
+     * Takes ownership only to release the object once it is sent; the bytes are the same as for a shared object.
+     */
     Task<void> ServerHttpReply::Send(Pointer<ara::rest::ogm::Object> &&data)
     {
-        String serializedData = data->Serialize();
-        return Send(serializedData);
+        Pointer<ara::rest::ogm::Object> owned = std::move(data);
+        return Send(owned);
     }
 
     Task<void> ServerHttpReply::Send(const StringView &data)
     {
-        return std::async([this, &data]() {
+        return SendBody(String(data), "application/json");
+    }
+
+    Task<void> ServerHttpReply::SendBody(String &&body, StringView contentType, StringView etag)
+    {
+        return std::async([this, body = std::move(body), contentType = String(contentType), etag = String(etag)]() {
             pocoReply_->setStatus(StatusCode::ToString(GetStatus()));
-            pocoReply_->setContentType("application/json");
-            pocoReply_->setContentLength(data.size());
+            pocoReply_->setContentType(contentType);
+            pocoReply_->setContentLength(body.size());
+            if (!etag.empty()) pocoReply_->set("ETag", etag);
 
             std::ostream& out = pocoReply_->send();
-            out << data;
+            out << body;
             out.flush();
         });
     }
 
+    Task<void> ServerHttpReply::SendNotModified(StringView etag)
+    {
+        return std::async([this, etag = String(etag)]() {
+            pocoReply_->setStatus(HTTPResponse::HTTP_NOT_MODIFIED);
+            pocoReply_->set("ETag", etag);
+            pocoReply_->set("Vary", "Accept");
+            pocoReply_->send().flush();
+        });
+    }
+
+    Task<void> ServerHttpReply::SendStreamed(const Pointer<ara::rest::ogm::Object> &data)
+    {
+        bool tagged = IsTagged();
+        if (tagged)
+        {
+            String etag = MakeETag(*data);
+            if (MatchesETag(ifNoneMatch_, etag)) return SendNotModified(etag);
+            pocoReply_->set("ETag", etag);
+        }
+        pocoReply_->set("Vary", "Accept");
+
+        ogm::Object *object = data.get();
+
+        return SendStreamed(contentType_, [this, object, tagged](ogm::OutputSink &sink)
+        {
+            Serialize(object, sink, tagged);
+        });
+    }
+
+    /**
+     * Runs on the calling thread: the writer may refer to state that only lives for the duration of the
+     * handler, and the sink already blocks on the connection whenever a chunk is full.
+     */
+    Task<void> ServerHttpReply::SendStreamed(StringView contentType, const Function<void(ogm::OutputSink&)> &writer)
+    {
+        std::promise<void> sent;
+        auto result = sent.get_future();
+
+        try
+        {
+            pocoReply_->setStatus(StatusCode::ToString(GetStatus()));
+            pocoReply_->setContentType(String(contentType));
+            pocoReply_->setChunkedTransferEncoding(true);
+
+            std::ostream& out = pocoReply_->send();
+            {
+                ogm::OutputSink sink(out);
+                writer(sink);
+            }
+            out.flush();
+
+            sent.set_value();
+        }
+        catch (...)
+        {
+            sent.set_exception(std::current_exception());
+        }
+
+        return result;
+    }
+
+    /**
+     * ETags are only worth computing for successful replies to GET and HEAD, the requests a cache may
+     * revalidate; If-None-Match does not apply to other statuses.
+     */
+    bool ServerHttpReply::IsTagged() const
+    {
+        return cacheable_ && GetHeader().GetStatus().IsSuccess();
+    }
+
+    /**
+     * A reply with a strong ETag must have identical bytes for equal objects, so tagged JSON is written in
+     * canonical form. Untagged replies keep the plain serializer, which may encode large subtrees in parallel.
+     */
+    void ServerHttpReply::Serialize(ogm::Object *object, ogm::OutputSink &sink, bool canonical) const
+    {
+        if (canonical && contentType_ == "application/json")
+        {
+            if (fields_) ogm::JsonSerializer::SerializeCanonical(*object, *fields_, sink);
+            else ogm::JsonSerializer::SerializeCanonical(*object, sink);
+        }
+        else if (fields_)
+        {
+            ogm::Serializer::Serialize(object, sink, contentType_, *fields_);
+        }
+        else
+        {
+            ogm::Serializer::Serialize(object, sink, contentType_);
+        }
+    }
+
+    /**
+     * The hash follows canonical member order. Only canonical JSON is byte-identical for equal hashes; the
+     * binary codecs keep insertion order, so their ETags are weak.
+     */
+    String ServerHttpReply::MakeETag(const ogm::Object &object) const
+    {
+        std::uint64_t hash = fields_ ? ogm::Hash(object, *fields_) : ogm::Hash(object);
+        hash = ogm::Hash(contentType_, hash);
+
+        char digits[16];
+        for (std::size_t i = 0; i < sizeof(digits); i++) digits[i] = "0123456789abcdef"[(hash >> (60 - 4 * i)) & 0xF];
+
+        String etag = contentType_ == "application/json" ? "\"" : "W/\"";
+        etag.append(digits, sizeof(digits));
+        etag += '"';
+
+        return etag;
+    }
+
+    /**
+     * If-None-Match uses the weak comparison of RFC 7232: the W/ prefix is ignored on both sides.
+     */
+    bool ServerHttpReply::MatchesETag(StringView ifNoneMatch, StringView etag)
+    {
+        if (etag.substr(0, 2) == "W/") etag.remove_prefix(2);
+
+        while (!ifNoneMatch.empty())
+        {
+            std::size_t comma = ifNoneMatch.find(',');
+            StringView candidate = ifNoneMatch.substr(0, comma);
+            ifNoneMatch.remove_prefix(comma == StringView::npos ? ifNoneMatch.size() : comma + 1);
+
+            while (!candidate.empty() && candidate.front() == ' ') candidate.remove_prefix(1);
+            while (!candidate.empty() && candidate.back() == ' ') candidate.remove_suffix(1);
+            if (candidate.substr(0, 2) == "W/") candidate.remove_prefix(2);
+
+            if (candidate == "*" || candidate == etag) return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * A malformed field list is ignored and the whole object is sent, as if the parameter were absent.
+     */
+    Pointer<ogm::Projection> ServerHttpReply::ParseFields(const Uri &uri)
+    {
+        if (!uri.HasQuery()) return nullptr;
+
+        const auto &query = uri.GetQuery();
+        auto parameter = query.Find("fields");
+        if (parameter == query.GetParameters().End() || !parameter->HasValue()) return nullptr;
+
+        try
+        {
+            return std::make_unique<ogm::Projection>(ogm::Projection::FromFieldList(parameter->GetValue()));
+        }
+        catch (const std::invalid_argument &)
+        {
+            return nullptr;
+        }
+    }
+
     Task<void> ServerHttpReply::Redirect(const Uri &uri)
     {
         return std::async([this, &uri]() {
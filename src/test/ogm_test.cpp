@@ -0,0 +1,1278 @@
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <ara/rest/ogm/object.h>
+#include <ara/rest/ogm/array.h>
+#include <ara/rest/ogm/field.h>
+#include <ara/rest/ogm/int.h>
+#include <ara/rest/ogm/real.h>
+#include <ara/rest/ogm/string.h>
+#include <ara/rest/ogm/hash.h>
+#include <ara/rest/ogm/projection.h>
+#include <ara/rest/ogm/atom.h>
+#include <ara/rest/ogm/arena.h>
+#include <ara/rest/ogm/mapping.h>
+#include <ara/rest/ogm/serializer/serializer.h>
+#include <ara/rest/ogm/serializer/serializer_registry.h>
+#include <ara/rest/ogm/serializer/json_serializer.h>
+#include <ara/rest/ogm/serializer/json_structural_index.h>
+#include <ara/rest/ogm/serializer/json_push_parser.h>
+#include <ara/rest/ogm/serializer/json_document.h>
+#include <ara/rest/ogm/serializer/worker_pool.h>
+
+using namespace ara::rest;
+
+struct Flags
+{
+    std::vector<bool> flags;
+};
+
+template <>
+struct ara::rest::ogm::Mapping<Flags>
+{
+    static constexpr auto fields = std::make_tuple(ogm::Map("flags", &Flags::flags));
+};
+
+struct Reading
+{
+    std::int64_t id = 0;
+    double load = 0;
+    String name;
+    bool ok = false;
+    std::vector<std::int8_t> levels;
+};
+
+template <>
+struct ara::rest::ogm::Mapping<Reading>
+{
+    static constexpr auto fields = std::make_tuple(ogm::Map("id", &Reading::id),
+                                                   ogm::Map("load", &Reading::load),
+                                                   ogm::Map("name", &Reading::name),
+                                                   ogm::Map("ok", &Reading::ok),
+                                                   ogm::Map("levels", &Reading::levels));
+};
+
+namespace
+{
+    int failures = 0;
+
+    void Check(bool condition, const char *test, const char *expression)
+    {
+        if (condition) return;
+
+        std::printf("%s: check failed: %s\n", test, expression);
+        failures++;
+    }
+
+#define CHECK(condition) Check((condition), name, #condition)
+
+    Pointer<ogm::Object> Parse(const char *json)
+    {
+        return ogm::Serializer::Deserialize(String(json), "application/json");
+    }
+
+    String Encode(const ogm::Object &object)
+    {
+        return object.Serialize();
+    }
+
+    /**
+     * A reference taken before ogm::Copy must not reach into the copy.
+     */
+    void TestCopyKeepsHeldScalarPrivate(const char *name)
+    {
+        auto original = Parse(R"({"n":1})");
+        auto &n = static_cast<ogm::Int&>((*original->Find("n"))->GetValue());
+
+        auto copy = ogm::Copy(original);
+        n.SetValue(42);
+
+        CHECK(Encode(*copy) == Encode(*Parse(R"({"n":1})")));
+        CHECK(Encode(*original) == Encode(*Parse(R"({"n":42})")));
+    }
+
+    void TestCopyKeepsHeldArrayPrivate(const char *name)
+    {
+        auto original = Parse(R"({"a":[{"x":1}]})");
+        auto &array = static_cast<ogm::Array&>((*original->Find("a"))->GetValue());
+        auto &element = static_cast<ogm::Object&>(array.GetValue(0));
+
+        auto copy = ogm::Copy(original);
+        array.Append(ogm::Int::Make(2));
+        element.Insert(ogm::Field::Make("y", ogm::Int::Make(3)));
+
+        CHECK(Encode(*copy) == Encode(*Parse(R"({"a":[{"x":1}]})")));
+        CHECK(Encode(*original) == Encode(*Parse(R"({"a":[{"x":1,"y":3},2]})")));
+    }
+
+    void TestCopyIsIndependentBothWays(const char *name)
+    {
+        auto original = Parse(R"({"a":{"b":{"c":[1,2,3]}},"d":"text"})");
+        String encoded = Encode(*original);
+
+        auto copy = ogm::Copy(original);
+        auto &b = static_cast<ogm::Object&>((*static_cast<ogm::Object&>((*copy->Find("a"))->GetValue()).Find("b"))->GetValue());
+        auto &c = static_cast<ogm::Array&>((*b.Find("c"))->GetValue());
+        c.Remove(c.GetValues().Begin());
+        static_cast<ogm::String&>((*copy->Find("d"))->GetValue()).SetValue("changed");
+
+        CHECK(Encode(*original) == encoded);
+        CHECK(Encode(*copy) == Encode(*Parse(R"({"a":{"b":{"c":[2,3]}},"d":"changed"})")));
+
+        auto again = ogm::Copy(copy);
+        c.Clear();
+        CHECK(Encode(*again) == Encode(*Parse(R"({"a":{"b":{"c":[2,3]}},"d":"changed"})")));
+    }
+
+    void TestCopyOfPackedArray(const char *name)
+    {
+        auto original = ogm::Array::Make();
+        for (int i = 0; i < 4; i++) original->AppendInt(i);
+
+        auto copy = ogm::Copy(original);
+        auto &first = static_cast<ogm::Int&>(copy->GetValue(0));
+        auto second = ogm::Copy(copy);
+        first.SetValue(7);
+
+        CHECK(static_cast<const ogm::Int&>(static_cast<const ogm::Array&>(*original).GetValue(0)).GetValue() == 0);
+        CHECK(static_cast<const ogm::Int&>(static_cast<const ogm::Array&>(*second).GetValue(0)).GetValue() == 0);
+        CHECK(static_cast<const ogm::Int&>(static_cast<const ogm::Array&>(*copy).GetValue(0)).GetValue() == 7);
+    }
+
+    /**
+     * Malformed streamed bodies are reported through the error code, for every codec.
+     */
+    void TestMalformedStreamSetsError(const char *name)
+    {
+        for (const char *type : { "application/json", "application/cbor", "application/msgpack" })
+        {
+            std::istringstream stream(std::string("{\"id\" : ", 8));
+            ErrorCode error;
+            auto object = ogm::Serializer::Deserialize(stream, type, error);
+            CHECK(static_cast<bool>(error));
+            CHECK(!object);
+        }
+
+        std::istringstream stream("{\"id\" : 1}");
+        ErrorCode error;
+        auto object = ogm::Serializer::Deserialize(stream, "application/json", error);
+        CHECK(!error);
+        CHECK(object && Encode(*object) == "{ \"id\" : 1 }");
+    }
+
+    /**
+     * The hash follows canonical JSON: member order is ignored, but the order of duplicate names is not.
+     */
+    void TestHashFollowsCanonicalOrder(const char *name)
+    {
+        CHECK(ogm::Hash(*Parse("{\"a\" : 1, \"b\" : 2}")) == ogm::Hash(*Parse("{\"b\" : 2, \"a\" : 1}")));
+        CHECK(ogm::Hash(*Parse("{\"a\" : 1, \"a\" : 2}")) != ogm::Hash(*Parse("{\"a\" : 2, \"a\" : 1}")));
+        CHECK(ogm::Hash(*Parse("{\"a\" : 1, \"b\" : 3, \"a\" : 2}")) == ogm::Hash(*Parse("{\"a\" : 1, \"a\" : 2, \"b\" : 3}")));
+    }
+
+    /**
+     * A member name below an array selects that member of each element, on every projected path.
+     */
+    void TestProjectionMapsOverArrays(const char *name)
+    {
+        const String json = "{\"items\" : [{\"id\" : 1, \"x\" : 2}, 3, {\"id\" : 4}], \"other\" : 5}";
+        const String expected = "{ \"items\" : [ { \"id\" : 1 }, { \"id\" : 4 } ] }";
+        auto projection = ogm::Projection::FromFieldList("items.id");
+
+        auto applied = Parse(json.c_str());
+        projection.Apply(*applied);
+        CHECK(Encode(*applied) == expected);
+
+        CHECK(Encode(*ogm::Serializer::Deserialize(json, "application/json", projection)) == expected);
+
+        std::istringstream stream(json);
+        CHECK(Encode(*ogm::Serializer::Deserialize(stream, "application/json", projection)) == expected);
+
+        String body;
+        ogm::OutputSink sink(body);
+        ogm::Serializer::Serialize(Parse(json.c_str()).get(), sink, "application/json", projection);
+        CHECK(body == expected);
+
+        auto indexed = ogm::Projection::FromFieldList("items.1");
+        auto element = Parse(json.c_str());
+        indexed.Apply(*element);
+        CHECK(Encode(*element) == "{ \"items\" : [ 3 ] }");
+    }
+
+    /**
+     * Strings that spell a literal stay strings in the binary codecs.
+     */
+    void TestLiteralStringsStayText(const char *name, const char *type, const std::string &expected)
+    {
+        auto object = Parse("{\"a\" : \"true\", \"b\" : \"null\"}");
+
+        String binary;
+        ogm::OutputSink sink(binary);
+        ogm::Serializer::Serialize(object.get(), sink, type);
+        CHECK(binary.find(expected) != String::npos);
+
+        auto decoded = ogm::Serializer::Deserialize(binary, type);
+        CHECK(Encode(*decoded) == Encode(*object));
+    }
+
+    void TestCborLiteralStrings(const char *name)
+    {
+        TestLiteralStringsStayText(name, "application/cbor", "\x64true");
+    }
+
+    void TestMsgPackLiteralStrings(const char *name)
+    {
+        TestLiteralStringsStayText(name, "application/msgpack", "\xa4true");
+    }
+
+    /**
+     * A borrowed name is viewed in place; GetName() copies it once and keeps returning that copy.
+     */
+    void TestBorrowedNameIsReadInPlace(const char *name)
+    {
+        const std::string key(80, 'k');
+        auto buffer = std::make_shared<const std::string>("{\"" + key + "\" : 1}");
+        auto object = ogm::Serializer::Deserialize(buffer);
+
+        const auto &field = **static_cast<const ogm::Object&>(*object).GetFields().Begin();
+        CHECK(field.GetNameView() == key);
+        CHECK(field.GetNameView().data() >= buffer->data() && field.GetNameView().data() < buffer->data() + buffer->size());
+
+        const std::string &copied = field.GetName();
+        CHECK(copied == key);
+        CHECK(&field.GetName() == &copied);
+    }
+
+    /**
+     * Parsed names never create atoms, and an object finds a name whether or not its field holds the atom.
+     */
+    void TestParsedNamesAreNotInterned(const char *name)
+    {
+        auto parsed = Parse("{\"parsed-only-name\" : 1, \"later-interned\" : 2}");
+        CHECK(ogm::Atom::Find("parsed-only-name") == nullptr);
+        CHECK(ogm::Atom::Find("later-interned") == nullptr);
+
+        auto field = ogm::Field::Make("later-interned", ogm::Int::Make(3));
+        CHECK(field->GetAtom() != nullptr);
+        CHECK(parsed->HasField("later-interned"));
+        CHECK(parsed->HasField("parsed-only-name"));
+        CHECK(!parsed->HasField("missing"));
+
+        auto reparsed = Parse("{\"later-interned\" : 4}");
+        const auto &first = **static_cast<const ogm::Object&>(*reparsed).GetFields().Begin();
+        CHECK(first.GetAtom() == field->GetAtom());
+    }
+
+    /**
+     * Arena nodes outlive their Arena and other blocks of it; heap nodes are freed alongside them.
+     */
+    void TestArenaNodesOutliveArena(const char *name)
+    {
+        auto heap = ogm::Object::Make();
+        Pointer<ogm::Object> kept;
+        Pointer<ogm::Object> wide;
+        {
+            ogm::Arena arena;
+            ogm::Arena::Scope scope(arena);
+
+            kept = Parse("{\"id\" : 1}");
+            wide = ogm::Object::Make();
+            for (int i = 0; i < 10000; i++) wide->Insert(ogm::Field::Make("f", ogm::Int::Make(i)));
+            CHECK(arena.GetCapacity() > ogm::Arena::kDefaultBlockSize);
+        }
+
+        wide.reset();
+        heap->Insert(ogm::Field::Make("id", ogm::Int::Make(2)));
+        CHECK(Encode(*kept) == "{ \"id\" : 1 }");
+        CHECK(Encode(*heap) == "{ \"id\" : 2 }");
+    }
+
+    /**
+     * Mapped vectors of bool read element by element, and unknown members are stepped over whatever their shape.
+     */
+    void TestMappedBoolVector(const char *name)
+    {
+        auto value = ogm::DeserializeStruct<Flags>(R"({"skipped":{"a":[1,{"b":"]"}]},"flags":[true,false,true]})");
+        CHECK((value.flags == std::vector<bool>{ true, false, true }));
+
+        for (StringView contentType : { "application/json", "application/cbor", "application/msgpack" })
+        {
+            auto again = ogm::DeserializeStruct<Flags>(ogm::SerializeStruct(value, contentType), contentType);
+            CHECK(again.flags == value.flags);
+        }
+    }
+
+    /**
+     * Only a parameter named q weighs a media range, and media types match regardless of case.
+     */
+    void TestNegotiateParsesParameters(const char *name)
+    {
+        auto &registry = ogm::SerializerRegistry::GetInstance();
+
+        CHECK(registry.Negotiate("application/cbor;level=1;seq=0.1, application/msgpack;q=0.5") == "application/cbor");
+        CHECK(registry.Negotiate("application/cbor; Q=0.2, Application/MsgPack") == "application/msgpack");
+        CHECK(registry.Negotiate("application/cbor;q=0, text/html") == "application/json");
+    }
+
+    /**
+     * Documents whose offsets do not fit the index are rejected before any byte is read, so the view only has
+     * to claim the size.
+     */
+    void TestIndexRejectsOversizedDocument(const char *name)
+    {
+        const char document[] = "{}";
+        ErrorCode error;
+        ogm::JsonStructuralIndex::Build(StringView(document, std::size_t(1) << 32), error);
+        CHECK(error == ogm::ParseError::kDocumentTooLarge);
+
+        error = ErrorCode();
+        CHECK(ogm::JsonStructuralIndex::Build(StringView(document, 2), error).GetSize() == 2);
+        CHECK(!error);
+    }
+
+    /**
+     * A document with containers nested depth levels deep below its root object, padded past the structural
+     * index threshold when indexed is set.
+     */
+    String Nest(std::size_t depth, bool indexed)
+    {
+        String json = "{\"pad\" : \"" + String(indexed ? 128 * 1024 : 0, 'x') + "\", \"a\" : ";
+        json += String(depth, '[') + String(depth, ']') + "}";
+
+        return json;
+    }
+
+    /**
+     * Nesting beyond Serializer::kMaxDepth is reported on every JSON path instead of overflowing the stack.
+     */
+    void TestJsonRejectsDeepNesting(const char *name)
+    {
+        for (bool indexed : { false, true })
+        {
+            ErrorCode error;
+            CHECK(ogm::Serializer::Deserialize(Nest(ogm::Serializer::kMaxDepth - 1, indexed), "application/json", error) != nullptr);
+            CHECK(!error);
+
+            ogm::Serializer::Deserialize(Nest(ogm::Serializer::kMaxDepth, indexed), "application/json", error);
+            CHECK(error == ogm::ParseError::kNestingTooDeep);
+
+            error = ErrorCode();
+            ogm::Serializer::Deserialize("{\"a\" : " + String(100000, '['), "application/json", error);
+            CHECK(error == ogm::ParseError::kNestingTooDeep);
+
+            error = ErrorCode();
+            std::istringstream stream(Nest(ogm::Serializer::kMaxDepth, indexed));
+            ogm::Serializer::Deserialize(stream, "application/json", error);
+            CHECK(error == ogm::ParseError::kNestingTooDeep);
+        }
+
+        bool rejected = false;
+        try
+        {
+            ogm::Serializer::Deserialize(Nest(ogm::Serializer::kMaxDepth, false), "application/json",
+                                         ogm::Projection::FromFieldList("a"));
+        }
+        catch (const std::invalid_argument&)
+        {
+            rejected = true;
+        }
+        CHECK(rejected);
+    }
+
+    /**
+     * Surrogate escapes decode only as a high and low pair; halves on their own are invalid escapes.
+     */
+    void TestJsonSurrogatePairs(const char *name)
+    {
+        ErrorCode error;
+        auto object = ogm::Serializer::Deserialize(String(R"({"s" : "\uD83D\uDE00"})"), "application/json", error);
+        CHECK(!error);
+        CHECK(object && static_cast<ogm::String&>((*object->Find("s"))->GetValue()).GetView() == "\xF0\x9F\x98\x80");
+
+        for (const char *json : { R"({"s" : "\uD800\u0041"})", R"({"s" : "\uD800"})", R"({"s" : "\uD800x"})",
+                                  R"({"s" : "\uDC00\uD800"})", R"({"s" : "\uD800\uD800"})" })
+        {
+            error = ErrorCode();
+            CHECK(!ogm::Serializer::Deserialize(String(json), "application/json", error));
+            CHECK(error == ogm::ParseError::kInvalidEscape);
+        }
+    }
+
+    /**
+     * Scalars are not structural, so an array holding a single scalar looks empty to the index alone.
+     */
+    void TestIndexedArrayOfOneScalar(const char *name)
+    {
+        const String pad = "{\"pad\" : \"" + String(128 * 1024, 'x') + "\", \"n\" : ";
+        for (const char *array : { "[5]", "[ \"s\" ]", "[ ]", "[[5], [], 7]" })
+        {
+            auto object = Parse((pad + array + "}").c_str());
+            auto small = Parse((String("{\"n\" : ") + array + "}").c_str());
+            CHECK((*object->Find("n"))->Serialize() == (*small->Find("n"))->Serialize());
+        }
+    }
+
+    /**
+     * Views see the single scalar of an array even though no structural token separates it from the brackets.
+     */
+    void TestViewOfArrayOfOneScalar(const char *name)
+    {
+        ogm::JsonDocument document(String(R"({"a" : [5], "b" : [ ], "c" : [[1], 2], "o" : { }})"));
+        auto root = document.GetRoot();
+
+        CHECK(root.GetSize() == 4);
+        CHECK(root.Find("a").GetSize() == 1);
+        CHECK(root.Find("a").GetValue(0).GetInt() == 5);
+        CHECK(root.Find("b").GetSize() == 0);
+        CHECK(!root.Find("b").GetValue(0).IsValid());
+        CHECK(root.Find("c").GetSize() == 2);
+        CHECK(root.Find("c").GetValue(0).GetSize() == 1);
+        CHECK(root.Find("c").GetValue(1).GetInt() == 2);
+        CHECK(root.Find("o").GetSize() == 0);
+    }
+
+    /**
+     * Numbers follow the RFC 8259 grammar on the cursor, indexed and push parsers alike.
+     */
+    void TestJsonNumberGrammar(const char *name)
+    {
+        auto parse = [](const String &number, bool indexed, bool streamed, ErrorCode &error)
+        {
+            String json = "{\"pad\" : \"" + String(indexed ? 128 * 1024 : 0, 'x') + "\", \"n\" : [" + number + "]}";
+            if (!streamed) return ogm::Serializer::Deserialize(json, "application/json", error);
+
+            std::istringstream stream(json);
+            return ogm::Serializer::Deserialize(stream, "application/json", error);
+        };
+
+        for (bool indexed : { false, true })
+        {
+            for (bool streamed : { false, true })
+            {
+                if (indexed && streamed) continue;
+
+                for (const char *number : { "0", "-0", "10", "0.5", "-1.25e+3", "1E-2", "0e0" })
+                {
+                    ErrorCode error;
+                    CHECK(parse(number, indexed, streamed, error) != nullptr);
+                    CHECK(!error);
+                }
+                for (const char *number : { "01", "-01", "1.", "-", "1e", "1e+", ".5", "-.5", "1.e3", "+1" })
+                {
+                    ErrorCode error;
+                    CHECK(!parse(number, indexed, streamed, error));
+                    CHECK(static_cast<bool>(error));
+                }
+            }
+        }
+    }
+
+    /**
+     * Only whitespace may follow the top-level value, on every JSON path.
+     */
+    void TestJsonRejectsTrailingBytes(const char *name)
+    {
+        for (bool indexed : { false, true })
+        {
+            const String document = "{\"pad\" : \"" + String(indexed ? 128 * 1024 : 0, 'x') + "\", \"a\" : 1}";
+
+            ErrorCode error;
+            CHECK(ogm::Serializer::Deserialize(document + " \n", "application/json", error) != nullptr);
+            CHECK(!error);
+
+            for (const char *trailer : { " garbage", "{}", ",", "]" })
+            {
+                error = ErrorCode();
+                CHECK(!ogm::Serializer::Deserialize(document + trailer, "application/json", error));
+                CHECK(error == ogm::ParseError::kUnexpectedToken);
+
+                error = ErrorCode();
+                std::istringstream stream(document + trailer);
+                CHECK(!ogm::Serializer::Deserialize(stream, "application/json", error));
+                CHECK(error == ogm::ParseError::kUnexpectedToken);
+
+                bool rejected = false;
+                try
+                {
+                    ogm::Serializer::Deserialize(document + trailer, "application/json", ogm::Projection::FromFieldList("a"));
+                }
+                catch (const std::invalid_argument&)
+                {
+                    rejected = true;
+                }
+                CHECK(rejected);
+            }
+        }
+
+        String array = "[";
+        for (std::size_t i = 0; i < 2 * 1024 * 1024; i++) array += "1,";
+        array += "1] x";
+
+        bool rejected = false;
+        try
+        {
+            ogm::Serializer::DeserializeArray(array, "application/json");
+        }
+        catch (const std::invalid_argument&)
+        {
+            rejected = true;
+        }
+        CHECK(rejected);
+    }
+
+    /**
+     * A CBOR map {"a" : value} whose value is prefix repeated count times followed by tail.
+     */
+    String NestCbor(char prefix, std::size_t count, const String &tail)
+    {
+        return String("\xA1\x61" "a", 3) + String(count, prefix) + tail;
+    }
+
+    /**
+     * Arrays, indefinite arrays and tag chains nested beyond Serializer::kMaxDepth are rejected as malformed
+     * input instead of overflowing the stack.
+     */
+    void TestCborRejectsDeepNesting(const char *name)
+    {
+        const std::size_t limit = ogm::Serializer::kMaxDepth;
+        for (char prefix : { '\x81', '\x9F', '\xC0' })
+        {
+            String tail = prefix == '\x9F' ? String(1, '\x01') + String(limit - 1, '\xFF') : String(1, '\x01');
+
+            ErrorCode error;
+            CHECK(ogm::Serializer::Deserialize(NestCbor(prefix, limit - 1, tail), "application/cbor", error) != nullptr);
+            CHECK(!error);
+
+            CHECK(!ogm::Serializer::Deserialize(NestCbor(prefix, limit, tail), "application/cbor", error));
+            CHECK(error == ogm::ParseError::kMalformedInput);
+
+            error = ErrorCode();
+            CHECK(!ogm::Serializer::Deserialize(NestCbor(prefix, 1000000, String()), "application/cbor", error));
+            CHECK(error == ogm::ParseError::kMalformedInput);
+        }
+    }
+
+    /**
+     * MessagePack arrays nested beyond Serializer::kMaxDepth are rejected as malformed input, from buffers and
+     * streams alike.
+     */
+    void TestMsgPackRejectsDeepNesting(const char *name)
+    {
+        auto nest = [](std::size_t depth, const String &tail)
+        {
+            return String("\x81\xA1" "a", 3) + String(depth, '\x91') + tail;
+        };
+        const std::size_t limit = ogm::Serializer::kMaxDepth;
+
+        ErrorCode error;
+        CHECK(ogm::Serializer::Deserialize(nest(limit - 1, "\x01"), "application/msgpack", error) != nullptr);
+        CHECK(!error);
+
+        for (const String &document : { nest(limit, "\x01"), nest(1000000, String()) })
+        {
+            error = ErrorCode();
+            CHECK(!ogm::Serializer::Deserialize(document, "application/msgpack", error));
+            CHECK(error == ogm::ParseError::kMalformedInput);
+
+            error = ErrorCode();
+            std::istringstream stream(document);
+            CHECK(!ogm::Serializer::Deserialize(stream, "application/msgpack", error));
+            CHECK(error == ogm::ParseError::kMalformedInput);
+        }
+    }
+
+    /**
+     * Length prefixes far beyond the input are reported through the error code, from a buffer and from a stream.
+     */
+    void TestHostileLengthPrefixes(const char *name)
+    {
+        const String huge8(8, '\xff');
+        const String huge4(4, '\xff');
+        const std::vector<std::pair<const char*, String>> payloads = {
+            { "application/cbor", String("\xa1\x61" "a\x7b", 4) + huge8 },
+            { "application/cbor", String("\xa1\x61" "a\x9b", 4) + huge8 },
+            { "application/cbor", String("\xa1\x61" "a\xbb", 4) + huge8 },
+            { "application/msgpack", String("\x81\xa1" "a\xdb", 4) + huge4 },
+            { "application/msgpack", String("\x81\xa1" "a\xdd", 4) + huge4 },
+            { "application/msgpack", String("\x81\xa1" "a\xdf", 4) + huge4 },
+        };
+
+        for (const auto &payload : payloads)
+        {
+            ErrorCode error;
+            CHECK(!ogm::Serializer::Deserialize(payload.second, payload.first, error));
+            CHECK(static_cast<bool>(error));
+
+            std::istringstream stream(payload.second);
+            ErrorCode streamError;
+            CHECK(!ogm::Serializer::Deserialize(stream, payload.first, streamError));
+            CHECK(static_cast<bool>(streamError));
+        }
+    }
+
+    /**
+     * A codec whose parser fails with something other than std::invalid_argument.
+     */
+    class ThrowingSerializer : public ogm::Serializer
+    {
+    public:
+        void Serialize(ogm::Value &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Int &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Real &, ogm::OutputSink &) override {}
+        void Serialize(ogm::String &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Array &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Object &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Field &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Value &, const ogm::Projection::Node &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Array &, const ogm::Projection::Node &, ogm::OutputSink &) override {}
+        void Serialize(ogm::Object &, const ogm::Projection::Node &, ogm::OutputSink &) override {}
+
+        Pointer<ogm::Value> DeserializeToValue(const String &) override { return nullptr; }
+        Pointer<ogm::Int> DeserializeToInt(const String &) override { return nullptr; }
+        Pointer<ogm::Real> DeserializeToReal(const String &) override { return nullptr; }
+        Pointer<ogm::String> DeserializeToString(const String &) override { return nullptr; }
+        Pointer<ogm::Array> DeserializeToArray(const String &) override { return nullptr; }
+        Pointer<ogm::Field> DeserializeToField(const String &) override { return nullptr; }
+
+        Pointer<ogm::Object> DeserializeToObject(const String &binary) override
+        {
+            if (binary == "length") throw std::length_error("too long");
+            if (binary == "alloc") throw std::bad_alloc();
+            throw std::out_of_range("out of range");
+        }
+    };
+
+    void TestCodecExceptionsBecomeErrors(const char *name)
+    {
+        ogm::SerializerRegistry::GetInstance().Register("application/x-throwing", Pointer<ogm::Serializer>(new ThrowingSerializer()));
+
+        ErrorCode error;
+        CHECK(!ogm::Serializer::Deserialize(String("length"), "application/x-throwing", error));
+        CHECK(error == ogm::ParseError::kDocumentTooLarge);
+
+        CHECK(!ogm::Serializer::Deserialize(String("alloc"), "application/x-throwing", error));
+        CHECK(error == ogm::ParseError::kDocumentTooLarge);
+
+        std::istringstream stream("other");
+        CHECK(!ogm::Serializer::Deserialize(stream, "application/x-throwing", error));
+        CHECK(error == ogm::ParseError::kMalformedInput);
+    }
+
+    /**
+     * Every task runs exactly once, also when Run is called from a task, and a task's exception reaches the caller.
+     */
+    void TestWorkerPool(const char *name)
+    {
+        auto &pool = ogm::WorkerPool::GetInstance();
+        CHECK(pool.GetConcurrency() >= 1);
+
+        std::vector<std::atomic<int>> runs(64);
+        pool.Run(runs.size(), [&](std::size_t outer)
+        {
+            pool.Run(4, [&](std::size_t) { runs[outer]++; });
+        });
+        bool once = true;
+        for (auto &count : runs) once = once && count == 4;
+        CHECK(once);
+
+        bool thrown = false;
+        try
+        {
+            pool.Run(8, [](std::size_t index) { if (index == 5) throw std::length_error("task"); });
+        }
+        catch (const std::length_error &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    /**
+     * Sharded serialization writes the same bytes as sequential serialization.
+     */
+    void TestShardedSerializationMatches(const char *name)
+    {
+        auto object = ogm::Object::Make();
+        auto values = ogm::Array::Make();
+        for (int i = 0; i < 1000; i++)
+        {
+            auto element = ogm::Object::Make();
+            element->Insert(ogm::Field::Make("id", ogm::Int::Make(i)));
+            element->Insert(ogm::Field::Make("name", ogm::String::Make("element-" + std::to_string(i))));
+            values->Append(std::move(element));
+        }
+        object->Insert(ogm::Field::Make("values", std::move(values)));
+
+        for (const char *type : { "application/json", "application/cbor", "application/msgpack" })
+        {
+            std::size_t threshold = ogm::Serializer::GetParallelThreshold();
+
+            String sequential;
+            ogm::OutputSink sequentialSink(sequential);
+            ogm::Serializer::SetParallelThreshold(0);
+            ogm::Serializer::Serialize(object.get(), sequentialSink, type);
+
+            String sharded;
+            ogm::OutputSink shardedSink(sharded);
+            ogm::Serializer::SetParallelThreshold(1);
+            ogm::Serializer::Serialize(object.get(), shardedSink, type);
+
+            ogm::Serializer::SetParallelThreshold(threshold);
+            CHECK(sharded == sequential);
+        }
+    }
+
+    /**
+     * Codecs tell the binders whether their replies are streamed, instead of the binders matching media types.
+     */
+    void TestStreamingCodecs(const char *name)
+    {
+        auto &registry = ogm::SerializerRegistry::GetInstance();
+        CHECK(registry.Get("application/msgpack").IsStreaming());
+        CHECK(!registry.Get("application/json").IsStreaming());
+        CHECK(!registry.Get("application/cbor").IsStreaming());
+    }
+
+    /**
+     * Find on a shared object: a miss still ends at GetFields(), and a found field is written without reaching copies.
+     */
+    void TestFindOnSharedObject(const char *name)
+    {
+        auto original = Parse(R"({"n":1})");
+        auto copy = ogm::Copy(original);
+
+        CHECK(original->Find("missing") == original->GetFields().End());
+        const ogm::Object &shared = *copy;
+        CHECK(shared.Find("missing") == shared.GetFields().End());
+
+        auto &n = static_cast<ogm::Int&>((*copy->Find("n"))->GetValue());
+        n.SetValue(2);
+        CHECK(Encode(*original) == Encode(*Parse(R"({"n":1})")));
+
+        auto again = ogm::Copy(copy);
+        n.SetValue(3);
+        CHECK(Encode(*again) == Encode(*Parse(R"({"n":2})")));
+        CHECK(Encode(*copy) == Encode(*Parse(R"({"n":3})")));
+    }
+
+    /**
+     * GetInt refuses reals an Int cannot hold instead of converting them.
+     */
+    void TestViewIntegerRange(const char *name)
+    {
+        ogm::JsonDocument document(String(R"({"big" : 1e400, "over" : 9.3e18, "under" : -9.3e18, "fits" : -9.2e18, "cut" : 2.9})"));
+        auto root = document.GetRoot();
+
+        for (const char *field : { "big", "over", "under" })
+        {
+            bool thrown = false;
+            try
+            {
+                root.Find(field).GetInt();
+            }
+            catch (const std::invalid_argument &)
+            {
+                thrown = true;
+            }
+            CHECK(thrown);
+        }
+        CHECK(root.Find("fits").GetInt() == -9200000000000000000);
+        CHECK(root.Find("cut").GetInt() == 2);
+    }
+
+    /**
+     * A document with broken structure reports it through GetError() and hands out an invalid root instead of throwing.
+     */
+    void TestMalformedDocumentReportsError(const char *name)
+    {
+        const std::vector<std::pair<const char*, ogm::ParseError>> documents = {
+            { R"({"a" : [1})", ogm::ParseError::kMalformedStructure },
+            { R"({"a" : 1)", ogm::ParseError::kMalformedStructure },
+            { R"({"a" : "1})", ogm::ParseError::kUnterminatedString },
+            { R"([1])", ogm::ParseError::kTypeMismatch },
+            { "  ", ogm::ParseError::kTypeMismatch },
+        };
+
+        for (const auto &entry : documents)
+        {
+            ogm::JsonDocument document{ String(entry.first) };
+            CHECK(document.GetError() == entry.second);
+            CHECK(!document.GetRoot().IsValid());
+            CHECK(document.GetRoot().GetSize() == 0);
+        }
+
+        ogm::JsonDocument valid(String(R"({"a" : 1})"));
+        CHECK(!valid.GetError());
+        CHECK(valid.GetRoot().IsValid());
+    }
+
+    /**
+     * Serializing into a sink appends to what it holds, and a stream-backed sink writes the same bytes in chunks.
+     */
+    void TestSinkAppends(const char *name)
+    {
+        auto object = Parse(R"({"a" : [1, 2.5, "three"], "b" : {"c" : null, "d" : true}})");
+
+        for (const char *type : { "application/json", "application/cbor", "application/msgpack" })
+        {
+            String whole;
+            ogm::OutputSink wholeSink(whole);
+            ogm::Serializer::Serialize(object.get(), wholeSink, type);
+
+            String appended = "prefix";
+            ogm::OutputSink appendedSink(appended);
+            ogm::Serializer::Serialize(object.get(), appendedSink, type);
+            CHECK(appended == "prefix" + whole);
+
+            std::ostringstream stream;
+            {
+                ogm::OutputSink streamSink(stream, 3);
+                ogm::Serializer::Serialize(object.get(), streamSink, type);
+                streamSink.Splice(String("tail"));
+            }
+            CHECK(stream.str() == whole + "tail");
+        }
+    }
+
+    /**
+     * A document large enough for the structural index parses to the same tree as the push parser builds.
+     */
+    void TestIndexedParseMatchesPushParser(const char *name)
+    {
+        String json = "{\"items\" : [";
+        for (int i = 0; json.size() < 256 * 1024; i++)
+        {
+            if (i) json += ", ";
+            json += "{\"id\" : " + std::to_string(i) + ", \"text\" : \"a \\\"quoted\\\" [bracket] {brace}, \\u00e9\", "
+                    "\"values\" : [" + std::to_string(-i) + ", 1.5e-3, true, null, []], \"empty\" : {}}";
+        }
+        json += "], \"tail\" : \"end\"}";
+
+        auto indexed = ogm::Serializer::Deserialize(json, "application/json");
+        std::istringstream stream(json);
+        auto pushed = ogm::Serializer::Deserialize(stream, "application/json");
+
+        CHECK(indexed != nullptr && pushed != nullptr);
+        CHECK(indexed && pushed && Encode(*indexed) == Encode(*pushed));
+    }
+
+    /**
+     * Every kind of value survives a round trip through a binary codec, and every truncation of the encoding is
+     * reported as an error.
+     */
+    void TestBinaryCodecRoundTrip(const char *name, const char *type)
+    {
+        auto object = Parse(R"({"int" : -42, "max" : 9223372036854775807, "min" : -9223372036854775808,
+                                "real" : 0.1, "tiny" : -2.5e-300, "text" : "café 😀", "empty" : "",
+                                "flags" : [true, false, null], "nested" : {"a" : [[], {}, [1, [2, [3]]]]}})");
+
+        String binary;
+        ogm::OutputSink sink(binary);
+        ogm::Serializer::Serialize(object.get(), sink, type);
+
+        auto decoded = ogm::Serializer::Deserialize(binary, type);
+        CHECK(decoded && Encode(*decoded) == Encode(*object));
+
+        bool rejected = true;
+        for (std::size_t size = 0; size < binary.size(); size++)
+        {
+            ErrorCode error;
+            auto truncated = ogm::Serializer::Deserialize(binary.substr(0, size), type, error);
+            rejected = rejected && !truncated && error;
+        }
+        CHECK(rejected);
+    }
+
+    void TestCborRoundTrip(const char *name)
+    {
+        TestBinaryCodecRoundTrip(name, "application/cbor");
+    }
+
+    /**
+     * MessagePack also decodes from a stream, so truncations are checked there too.
+     */
+    void TestMsgPackRoundTrip(const char *name)
+    {
+        TestBinaryCodecRoundTrip(name, "application/msgpack");
+
+        String binary;
+        ogm::OutputSink sink(binary);
+        auto object = Parse(R"({"a" : [1, "two", {"three" : 3.5}]})");
+        ogm::Serializer::Serialize(object.get(), sink, "application/msgpack");
+
+        std::istringstream stream(binary);
+        auto decoded = ogm::Serializer::Deserialize(stream, "application/msgpack");
+        CHECK(decoded && Encode(*decoded) == Encode(*object));
+
+        bool rejected = true;
+        for (std::size_t size = 0; size < binary.size(); size++)
+        {
+            std::istringstream truncated(binary.substr(0, size));
+            ErrorCode error;
+            rejected = rejected && !ogm::Serializer::Deserialize(truncated, "application/msgpack", error) && error;
+        }
+        CHECK(rejected);
+    }
+
+    /**
+     * A mapped struct round-trips through every codec, its encoding is what the OGM codecs read, and values that
+     * do not fit a member are rejected.
+     */
+    void TestMappedStructRoundTrip(const char *name)
+    {
+        Reading reading;
+        reading.id = -9223372036854775807 - 1;
+        reading.load = 0.25;
+        reading.name = "sensor \"7\"";
+        reading.ok = true;
+        reading.levels = { -128, 0, 127 };
+
+        for (StringView contentType : { "application/json", "application/cbor", "application/msgpack" })
+        {
+            String binary = ogm::SerializeStruct(reading, contentType);
+            auto again = ogm::DeserializeStruct<Reading>(binary, contentType);
+            CHECK(again.id == reading.id && again.load == reading.load && again.name == reading.name);
+            CHECK(again.ok == reading.ok && again.levels == reading.levels);
+
+            auto object = ogm::Serializer::Deserialize(binary, contentType);
+            CHECK(object && object->GetSize() == 5 && object->HasField("levels"));
+        }
+
+        bool thrown = false;
+        try
+        {
+            ogm::DeserializeStruct<Reading>(R"({"levels" : [128]})");
+        }
+        catch (const std::invalid_argument &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    /**
+     * Numbers are written in their shortest form and read back exactly, whatever the global locale.
+     */
+    void TestNumbersRoundTrip(const char *name)
+    {
+        const std::vector<long double> reals = { 0.1L, -2.5L, 123456789.125L, 1e-300L, 1.7976931348623157e308L, 5e-324L };
+        const std::vector<std::int64_t> ints = { 0, -1, 9223372036854775807, -9223372036854775807 - 1 };
+
+        for (long double real : reals)
+        {
+            auto object = ogm::Object::Make();
+            object->Insert(ogm::Field::Make("r", ogm::Real::Make(real)));
+            auto parsed = ogm::Serializer::Deserialize(Encode(*object));
+
+            const auto &value = (*parsed->Find("r"))->GetValue();
+            CHECK(value.IsReal() && static_cast<const ogm::Real&>(value).GetValue() == real);
+        }
+
+        for (std::int64_t integer : ints)
+        {
+            auto object = ogm::Object::Make();
+            object->Insert(ogm::Field::Make("i", ogm::Int::Make(integer)));
+            auto parsed = ogm::Serializer::Deserialize(Encode(*object));
+
+            const auto &value = (*parsed->Find("i"))->GetValue();
+            CHECK(value.IsInt() && static_cast<const ogm::Int&>(value).GetValue() == integer);
+        }
+
+        auto tenth = ogm::Object::Make();
+        tenth->Insert(ogm::Field::Make("r", ogm::Real::Make(0.1L)));
+        CHECK(Encode(*tenth).find("0.1 ") != String::npos || Encode(*tenth).find("0.1}") != String::npos);
+    }
+
+    /**
+     * The push parser builds the same object wherever the body is split into chunks, and reports a document that
+     * ends early.
+     */
+    void TestPushParserChunkBoundaries(const char *name)
+    {
+        const String json = R"({"text" : "a \"quoted\" é 😀", "number" : -12.5e-3, "big" : 9223372036854775807,)"
+                            R"( "flags" : [true, false, null], "nested" : {"list" : [[], {}, [1, [2]]]}})";
+        const String expected = Encode(*Parse(json.c_str()));
+
+        bool same = true;
+        for (std::size_t split = 0; split <= json.size(); split++)
+        {
+            ErrorCode error;
+            ogm::JsonPushParser parser;
+            parser.Feed(StringView(json).substr(0, split), error);
+            parser.Feed(StringView(json).substr(split), error);
+            auto object = parser.Finish(error);
+
+            same = same && object && !error && Encode(*object) == expected;
+        }
+        CHECK(same);
+
+        ErrorCode error;
+        ogm::JsonPushParser byteWise;
+        for (char c : json) byteWise.Feed(StringView(&c, 1), error);
+        auto object = byteWise.Finish(error);
+        CHECK(object && Encode(*object) == expected);
+
+        ogm::JsonPushParser truncated;
+        truncated.Feed(StringView(json).substr(0, json.size() - 1), error);
+        CHECK(!truncated.IsComplete());
+        CHECK(!truncated.Finish(error) && static_cast<bool>(error));
+    }
+
+    /**
+     * A projection applied while decoding a binary body keeps the same fields as one applied afterwards, from a
+     * string and from a stream.
+     */
+    void TestBinaryProjection(const char *name, const char *type)
+    {
+        const char *json = R"({"items" : [{"id" : 1, "x" : {"deep" : [1, 2]}}, 3, {"id" : 4}], "other" : 5, "keep" : {"a" : 1, "b" : 2}})";
+        auto projection = ogm::Projection::FromFieldList("items.id,keep.b");
+
+        auto expected = Parse(json);
+        projection.Apply(*expected);
+
+        String binary;
+        ogm::OutputSink sink(binary);
+        ogm::Serializer::Serialize(Parse(json).get(), sink, type);
+
+        auto decoded = ogm::Serializer::Deserialize(binary, type, projection);
+        CHECK(decoded && Encode(*decoded) == Encode(*expected));
+
+        std::istringstream stream(binary);
+        auto streamed = ogm::Serializer::Deserialize(stream, type, projection);
+        CHECK(streamed && Encode(*streamed) == Encode(*expected));
+    }
+
+    void TestCborProjection(const char *name)
+    {
+        TestBinaryProjection(name, "application/cbor");
+    }
+
+    void TestMsgPackProjection(const char *name)
+    {
+        TestBinaryProjection(name, "application/msgpack");
+    }
+
+    /**
+     * Lookups in an object wide enough to be indexed agree with a linear scan after every kind of change.
+     */
+    void TestWideObjectLookup(const char *name)
+    {
+        auto object = ogm::Object::Make();
+        for (int i = 0; i < 100; i++) object->Insert(ogm::Field::Make("f" + std::to_string(i), ogm::Int::Make(i)));
+        object->Insert(ogm::Field::Make("f5", ogm::Int::Make(-5)));
+
+        const ogm::Object &view = *object;
+        auto valueOf = [&view](const char *key) {
+            auto found = view.Find(key);
+            return found == view.GetFields().End() ? -1 : static_cast<const ogm::Int&>((*found)->GetValue()).GetValue();
+        };
+
+        bool found = true;
+        for (int i = 0; i < 100; i++) found = found && valueOf(("f" + std::to_string(i)).c_str()) == i;
+        CHECK(found);
+        CHECK(valueOf("f5") == 5 && !view.HasField("f100"));
+
+        object->Remove(object->Find("f10"));
+        CHECK(!view.HasField("f10") && valueOf("f11") == 11 && valueOf("f99") == 99);
+
+        object->Replace(object->Find("f20"), ogm::Field::Make("g", ogm::Int::Make(20)));
+        CHECK(!view.HasField("f20") && valueOf("g") == 20 && valueOf("f21") == 21);
+
+        object->Release(object->Find("f5"));
+        CHECK(valueOf("f5") == -5);
+
+        object->Clear();
+        CHECK(!view.HasField("f0") && view.Find("g") == view.GetFields().End());
+
+        object->Insert(ogm::Field::Make("f0", ogm::Int::Make(7)));
+        CHECK(valueOf("f0") == 7);
+    }
+
+    /**
+     * Release and Replace hand back the node that was in the container, not a copy of it.
+     */
+    void TestReleaseReturnsOriginal(const char *name)
+    {
+        auto object = Parse(R"({"a" : {"deep" : [1, 2]}, "b" : 2})");
+        const ogm::Field *a = object->Find("a")->get();
+        const ogm::Field *b = object->Find("b")->get();
+
+        auto released = object->Release(object->Find("a"));
+        CHECK(released.second.get() == a && !object->HasField("a"));
+        CHECK(released.first == object->Find("b"));
+
+        auto replaced = object->Replace(object->Find("b"), ogm::Field::Make("c", ogm::Int::Make(3)));
+        CHECK(replaced.get() == b && object->HasField("c") && !object->HasField("b"));
+
+        auto array = ogm::Array::Make();
+        for (int i = 0; i < 3; i++) array->Append(ogm::String::Make("s" + std::to_string(i)));
+        const ogm::Value *first = &static_cast<const ogm::Array&>(*array).GetValue(0);
+        const ogm::Value *second = &static_cast<const ogm::Array&>(*array).GetValue(1);
+
+        auto element = array->Release(array->GetValues().Begin());
+        CHECK(element.second.get() == first && array->GetSize() == 2);
+
+        auto old = array->Replace(array->GetValues().Begin(), ogm::String::Make("new"));
+        CHECK(old.get() == second);
+    }
+
+    /**
+     * A top-level array above the 4 MiB parallel threshold parses to the same elements as the sequential
+     * parser builds, and an error in any element is still reported.
+     */
+    void TestLargeTopLevelArray(const char *name)
+    {
+        String json = "[";
+        for (int i = 0; json.size() < 5 * 1024 * 1024; i++)
+        {
+            if (i) json += ", ";
+            json += "{\"id\" : " + std::to_string(i) + ", \"text\" : \"a, [b] {c}\", \"list\" : [" + std::to_string(i) + ", [], {}]}";
+        }
+        json += "]";
+
+        auto parallel = ogm::Serializer::DeserializeArray(json, "application/json");
+        auto sequential = Parse(("{\"values\" : " + json + "}").c_str());
+
+        auto wrapped = ogm::Object::Make();
+        wrapped->Insert(ogm::Field::Make("values", std::move(parallel)));
+        CHECK(Encode(*wrapped) == Encode(*sequential));
+
+        String broken = json;
+        broken[broken.size() / 2 + broken.substr(broken.size() / 2).find("\"id\"")] = '\'';
+        bool rejected = false;
+        try
+        {
+            ogm::Serializer::DeserializeArray(broken, "application/json");
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejected = true;
+        }
+        CHECK(rejected);
+    }
+
+    /**
+     * Codecs registered from several threads are all found, lookups during registration keep returning the
+     * built-in codecs, and a media type cannot be registered twice.
+     */
+    void TestConcurrentRegistration(const char *name)
+    {
+        auto &registry = ogm::SerializerRegistry::GetInstance();
+        ogm::Serializer *json = registry.Find("application/json");
+
+        CHECK(!registry.Register("application/json", Pointer<ogm::Serializer>(new ThrowingSerializer())));
+        CHECK(registry.Find("application/json") == json);
+
+        std::atomic<bool> stable{ true };
+        std::atomic<int> registered{ 0 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&]() {
+                for (int i = 0; i < 16; i++)
+                {
+                    String type = "application/x-concurrent-" + std::to_string(i);
+                    if (registry.Register(type, Pointer<ogm::Serializer>(new ThrowingSerializer()))) registered++;
+                    if (&registry.Get("application/json; charset=utf-8") != json) stable = false;
+                    if (!registry.Find(type)) stable = false;
+                }
+            });
+        }
+        for (auto &thread : threads) thread.join();
+
+        CHECK(stable);
+        CHECK(registered == 16);
+    }
+
+    /**
+     * Objects that are equal up to member order have the same canonical bytes and hash, with or without a
+     * projection.
+     */
+    void TestCanonicalBytesMatchHash(const char *name)
+    {
+        auto first = Parse(R"({"b" : {"y" : [1, 2], "x" : "é"}, "a" : 0.5, "c" : null})");
+        auto second = Parse(R"({"c" : null, "a" : 0.5, "b" : {"x" : "é", "y" : [1, 2]}})");
+        auto different = Parse(R"({"c" : null, "a" : 0.5, "b" : {"x" : "é", "y" : [2, 1]}})");
+
+        auto canonical = [](const ogm::Object &object) {
+            String body;
+            ogm::OutputSink sink(body);
+            ogm::JsonSerializer::SerializeCanonical(object, sink);
+            return body;
+        };
+
+        CHECK(canonical(*first) == canonical(*second) && ogm::Hash(*first) == ogm::Hash(*second));
+        CHECK(canonical(*first) != canonical(*different) && ogm::Hash(*first) != ogm::Hash(*different));
+
+        auto projection = ogm::Projection::FromFieldList("b.x,a");
+        String projected;
+        ogm::OutputSink sink(projected);
+        ogm::JsonSerializer::SerializeCanonical(*first, projection, sink);
+
+        auto applied = Parse(R"({"a" : 0.5, "b" : {"x" : "é"}})");
+        CHECK(projected == canonical(*applied));
+        CHECK(ogm::Hash(*first, projection) == ogm::Hash(*different, projection));
+    }
+}
+
+int main()
+{
+    const std::vector<std::pair<const char*, std::function<void(const char*)>>> tests = {
+        { "copy keeps held scalar private", TestCopyKeepsHeldScalarPrivate },
+        { "copy keeps held array private", TestCopyKeepsHeldArrayPrivate },
+        { "copy is independent both ways", TestCopyIsIndependentBothWays },
+        { "copy of packed array", TestCopyOfPackedArray },
+        { "malformed stream sets error", TestMalformedStreamSetsError },
+        { "hash follows canonical order", TestHashFollowsCanonicalOrder },
+        { "projection maps over arrays", TestProjectionMapsOverArrays },
+        { "cbor literal strings", TestCborLiteralStrings },
+        { "msgpack literal strings", TestMsgPackLiteralStrings },
+        { "borrowed name is read in place", TestBorrowedNameIsReadInPlace },
+        { "parsed names are not interned", TestParsedNamesAreNotInterned },
+        { "arena nodes outlive arena", TestArenaNodesOutliveArena },
+        { "mapped bool vector", TestMappedBoolVector },
+        { "negotiate parses parameters", TestNegotiateParsesParameters },
+        { "index rejects oversized document", TestIndexRejectsOversizedDocument },
+        { "json rejects deep nesting", TestJsonRejectsDeepNesting },
+        { "json surrogate pairs", TestJsonSurrogatePairs },
+        { "indexed array of one scalar", TestIndexedArrayOfOneScalar },
+        { "view of array of one scalar", TestViewOfArrayOfOneScalar },
+        { "json number grammar", TestJsonNumberGrammar },
+        { "json rejects trailing bytes", TestJsonRejectsTrailingBytes },
+        { "cbor rejects deep nesting", TestCborRejectsDeepNesting },
+        { "msgpack rejects deep nesting", TestMsgPackRejectsDeepNesting },
+        { "hostile length prefixes", TestHostileLengthPrefixes },
+        { "codec exceptions become errors", TestCodecExceptionsBecomeErrors },
+        { "worker pool", TestWorkerPool },
+        { "sharded serialization matches", TestShardedSerializationMatches },
+        { "streaming codecs", TestStreamingCodecs },
+        { "find on shared object", TestFindOnSharedObject },
+        { "view integer range", TestViewIntegerRange },
+        { "malformed document reports error", TestMalformedDocumentReportsError },
+        { "sink appends", TestSinkAppends },
+        { "indexed parse matches push parser", TestIndexedParseMatchesPushParser },
+        { "cbor round trip", TestCborRoundTrip },
+        { "msgpack round trip", TestMsgPackRoundTrip },
+        { "mapped struct round trip", TestMappedStructRoundTrip },
+        { "numbers round trip", TestNumbersRoundTrip },
+        { "push parser chunk boundaries", TestPushParserChunkBoundaries },
+        { "cbor projection", TestCborProjection },
+        { "msgpack projection", TestMsgPackProjection },
+        { "wide object lookup", TestWideObjectLookup },
+        { "release returns original", TestReleaseReturnsOriginal },
+        { "large top-level array", TestLargeTopLevelArray },
+        { "concurrent registration", TestConcurrentRegistration },
+        { "canonical bytes match hash", TestCanonicalBytesMatchHash },
+    };
+
+    for (const auto &test : tests) test.second(test.first);
+
+    std::printf("%zu tests, %d failed checks\n", tests.size(), failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -428,6 +428,7 @@ namespace rest
             }
         }
 
+        index_.Rebuild(parameters_.size(), [this](std::size_t at) { return StringView(parameters_[at].key_); });
     }
 
     /**
@@ -445,14 +446,19 @@ namespace rest
 
     Uri::Query::IteratorRange::Iterator Uri::Query::Find(String key) const
     {
-        return std::find_if(parameters_.begin(), parameters_.end(),
-                            [&](const Parameter &parameter) { return key == parameter.GetKey(); });
+        if (!index_.IsActive())
+        {
+            return std::find_if(parameters_.begin(), parameters_.end(),
+                                [&](const Parameter &parameter) { return key == parameter.key_; });
+        }
+
+        std::size_t position = index_.Find(key, [this](std::size_t at) { return StringView(parameters_[at].key_); });
+        return position == NameIndex::npos ? parameters_.end() : parameters_.begin() + position;
     }
 
     bool Uri::Query::HasKey(String key)
     {
-        return std::any_of(parameters_.begin(), parameters_.end(),
-                           [&](const Parameter &parameter) { return key == parameter.GetKey(); });
+        return Find(std::move(key)) != parameters_.end();
     }
 
     Uri::Query::IteratorRange Uri::Query::GetParameters() const